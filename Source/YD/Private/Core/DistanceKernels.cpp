@@ -0,0 +1,268 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/DistanceKernels.h"
+#include "Math/VectorRegister.h"
+#include "Algo/Heapify.h"
+#include "Algo/Sort.h"
+
+namespace DistanceKernels
+{
+	/** dx*dx + dy*dy + dz*dz for four candidates */
+	static FORCEINLINE VectorRegister4Float DistSquared4(
+		const VectorRegister4Float& OriginX, const VectorRegister4Float& OriginY, const VectorRegister4Float& OriginZ,
+		const float* X, const float* Y, const float* Z)
+	{
+		const VectorRegister4Float DeltaX = VectorSubtract(VectorLoad(X), OriginX);
+		const VectorRegister4Float DeltaY = VectorSubtract(VectorLoad(Y), OriginY);
+		const VectorRegister4Float DeltaZ = VectorSubtract(VectorLoad(Z), OriginZ);
+
+		return VectorMultiplyAdd(DeltaX, DeltaX, VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaZ, DeltaZ)));
+	}
+
+	static FORCEINLINE float DistSquared1(const FVector3f& Origin, float X, float Y, float Z)
+	{
+		const float DeltaX = X - Origin.X;
+		const float DeltaY = Y - Origin.Y;
+		const float DeltaZ = Z - Origin.Z;
+		return DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+	}
+
+	/**
+	 * angle(D, V) <= Half  <=>  D.V >= |V| cos(Half), squared on both sides:
+	 * Half <= 90: D.V >= 0 && (D.V)^2 >= |V|^2 cos^2, wider cones: D.V >= 0 || (D.V)^2 <= |V|^2 cos^2
+	 */
+	static FORCEINLINE bool InCone1(const FVector3f& Origin, const FVector3f& Direction, float CosSquared, bool bWide, float MaxDistSquared, float X, float Y, float Z)
+	{
+		const float DeltaX = X - Origin.X;
+		const float DeltaY = Y - Origin.Y;
+		const float DeltaZ = Z - Origin.Z;
+		const float LengthSquared = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+		if (LengthSquared > MaxDistSquared)
+			return false;
+
+		const float Dot = Direction.X * DeltaX + Direction.Y * DeltaY + Direction.Z * DeltaZ;
+		const float DotSquared = Dot * Dot;
+		const float Threshold = LengthSquared * CosSquared;
+
+		return bWide
+			? (Dot >= 0.f || DotSquared <= Threshold)
+			: (Dot >= 0.f && DotSquared >= Threshold);
+	}
+
+	void ComputeDistSquared(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float* OutDistSquared)
+	{
+		const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+		const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+		const VectorRegister4Float OriginZ = VectorSetFloat1(Origin.Z);
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			VectorStore(DistSquared4(OriginX, OriginY, OriginZ, X + i, Y + i, Z + i), OutDistSquared + i);
+		}
+
+		for (; i < Num; i++)
+		{
+			OutDistSquared[i] = DistSquared1(Origin, X[i], Y[i], Z[i]);
+		}
+	}
+
+	int32 FindNearest(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float MaxDistSquared)
+	{
+		const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+		const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+		const VectorRegister4Float OriginZ = VectorSetFloat1(Origin.Z);
+
+		int32 BestIndex = INDEX_NONE;
+		float BestDistSquared = MaxDistSquared;
+		VectorRegister4Float BestVector = VectorSetFloat1(BestDistSquared);
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const VectorRegister4Float DistSquared = DistSquared4(OriginX, OriginY, OriginZ, X + i, Y + i, Z + i);
+
+			// Improvements are rare after the first few blocks - only drop to scalar when a lane beats the best
+			if (VectorMaskBits(VectorCompareLT(DistSquared, BestVector)) == 0)
+				continue;
+
+			alignas(16) float Lanes[4];
+			VectorStoreAligned(DistSquared, Lanes);
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				if (Lanes[Lane] < BestDistSquared)
+				{
+					BestDistSquared = Lanes[Lane];
+					BestIndex = i + Lane;
+				}
+			}
+			BestVector = VectorSetFloat1(BestDistSquared);
+		}
+
+		for (; i < Num; i++)
+		{
+			const float DistSquared = DistSquared1(Origin, X[i], Y[i], Z[i]);
+			if (DistSquared < BestDistSquared)
+			{
+				BestDistSquared = DistSquared;
+				BestIndex = i;
+			}
+		}
+
+		return BestIndex;
+	}
+
+	int32 SelectKNearest(const float* DistSquared, int32 Num, int32 K, int32* OutIndices)
+	{
+		K = FMath::Min(K, Num);
+		if (K <= 0)
+			return 0;
+
+		// Nearest first, index breaks ties so results are stable
+		auto IsCloser = [DistSquared](int32 A, int32 B)
+		{
+			return DistSquared[A] < DistSquared[B] || (DistSquared[A] == DistSquared[B] && A < B);
+		};
+
+		if (K == 1)
+		{
+			int32 Best = 0;
+			for (int32 i = 1; i < Num; i++)
+			{
+				if (IsCloser(i, Best))
+				{
+					Best = i;
+				}
+			}
+			OutIndices[0] = Best;
+			return 1;
+		}
+
+		// Bounded max-heap of size K in the output buffer: top = farthest of the current K
+		auto IsFarther = [&IsCloser](int32 A, int32 B) { return IsCloser(B, A); };
+
+		for (int32 i = 0; i < K; i++)
+		{
+			OutIndices[i] = i;
+		}
+		Algo::Heapify(TArrayView<int32>(OutIndices, K), IsFarther);
+
+		for (int32 i = K; i < Num; i++)
+		{
+			if (!IsCloser(i, OutIndices[0]))
+				continue;
+
+			// Replace the farthest and sift it down (O(log K))
+			OutIndices[0] = i;
+			int32 Parent = 0;
+			for (;;)
+			{
+				const int32 Left = Parent * 2 + 1;
+				if (Left >= K)
+					break;
+
+				const int32 Right = Left + 1;
+				const int32 Child = (Right < K && IsFarther(OutIndices[Right], OutIndices[Left])) ? Right : Left;
+				if (!IsFarther(OutIndices[Child], OutIndices[Parent]))
+					break;
+
+				Swap(OutIndices[Child], OutIndices[Parent]);
+				Parent = Child;
+			}
+		}
+
+		Algo::Sort(TArrayView<int32>(OutIndices, K), IsCloser);
+		return K;
+	}
+
+	int32 ConeMask(const FVector3f& Origin, const FVector3f& Direction, float CosHalf, float MaxDistSquared, const float* X, const float* Y, const float* Z, int32 Num, uint8* OutInside)
+	{
+		const float CosSquared = CosHalf * CosHalf;
+		const bool bWide = CosHalf < 0.f;
+
+		const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+		const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+		const VectorRegister4Float OriginZ = VectorSetFloat1(Origin.Z);
+		const VectorRegister4Float DirectionX = VectorSetFloat1(Direction.X);
+		const VectorRegister4Float DirectionY = VectorSetFloat1(Direction.Y);
+		const VectorRegister4Float DirectionZ = VectorSetFloat1(Direction.Z);
+		const VectorRegister4Float CosSquaredVector = VectorSetFloat1(CosSquared);
+		const VectorRegister4Float MaxDistVector = VectorSetFloat1(MaxDistSquared);
+		const VectorRegister4Float Zero = VectorZeroFloat();
+
+		int32 NumInside = 0;
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const VectorRegister4Float DeltaX = VectorSubtract(VectorLoad(X + i), OriginX);
+			const VectorRegister4Float DeltaY = VectorSubtract(VectorLoad(Y + i), OriginY);
+			const VectorRegister4Float DeltaZ = VectorSubtract(VectorLoad(Z + i), OriginZ);
+
+			const VectorRegister4Float LengthSquared = VectorMultiplyAdd(DeltaX, DeltaX, VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaZ, DeltaZ)));
+			const VectorRegister4Float Dot = VectorMultiplyAdd(DirectionX, DeltaX, VectorMultiplyAdd(DirectionY, DeltaY, VectorMultiply(DirectionZ, DeltaZ)));
+			const VectorRegister4Float DotSquared = VectorMultiply(Dot, Dot);
+			const VectorRegister4Float Threshold = VectorMultiply(LengthSquared, CosSquaredVector);
+
+			const VectorRegister4Float Forward = VectorCompareGE(Dot, Zero);
+			const VectorRegister4Float InAngle = bWide
+				? VectorBitwiseOr(Forward, VectorCompareLE(DotSquared, Threshold))
+				: VectorBitwiseAnd(Forward, VectorCompareGE(DotSquared, Threshold));
+			const uint32 Bits = VectorMaskBits(VectorBitwiseAnd(InAngle, VectorCompareLE(LengthSquared, MaxDistVector)));
+
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				OutInside[i + Lane] = static_cast<uint8>((Bits >> Lane) & 1);
+			}
+			NumInside += FMath::CountBits(Bits);
+		}
+
+		for (; i < Num; i++)
+		{
+			OutInside[i] = InCone1(Origin, Direction, CosSquared, bWide, MaxDistSquared, X[i], Y[i], Z[i]) ? 1 : 0;
+			NumInside += OutInside[i];
+		}
+
+		return NumInside;
+	}
+
+	void ComputeDistSquaredScalar(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float* OutDistSquared)
+	{
+		for (int32 i = 0; i < Num; i++)
+		{
+			OutDistSquared[i] = DistSquared1(Origin, X[i], Y[i], Z[i]);
+		}
+	}
+
+	int32 FindNearestScalar(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float MaxDistSquared)
+	{
+		int32 BestIndex = INDEX_NONE;
+		float BestDistSquared = MaxDistSquared;
+
+		for (int32 i = 0; i < Num; i++)
+		{
+			const float DistSquared = DistSquared1(Origin, X[i], Y[i], Z[i]);
+			if (DistSquared < BestDistSquared)
+			{
+				BestDistSquared = DistSquared;
+				BestIndex = i;
+			}
+		}
+
+		return BestIndex;
+	}
+
+	int32 ConeMaskScalar(const FVector3f& Origin, const FVector3f& Direction, float CosHalf, float MaxDistSquared, const float* X, const float* Y, const float* Z, int32 Num, uint8* OutInside)
+	{
+		const float CosSquared = CosHalf * CosHalf;
+		const bool bWide = CosHalf < 0.f;
+
+		int32 NumInside = 0;
+		for (int32 i = 0; i < Num; i++)
+		{
+			OutInside[i] = InCone1(Origin, Direction, CosSquared, bWide, MaxDistSquared, X[i], Y[i], Z[i]) ? 1 : 0;
+			NumInside += OutInside[i];
+		}
+
+		return NumInside;
+	}
+}
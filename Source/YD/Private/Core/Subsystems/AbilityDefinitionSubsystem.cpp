@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/AbilityDefinitionSubsystem.h"
+#include "Gameplay/Data/AbilityDefinition.h"
+#include "Gameplay/Data/AbilityData.h"
+
+void UAbilityDefinitionSubsystem::Deinitialize()
+{
+	Definitions.Empty();
+
+	Super::Deinitialize();
+}
+
+UAbilityDefinition* UAbilityDefinitionSubsystem::GetDefinition(UAbilityData* Data)
+{
+	if (!Data)
+		return nullptr;
+
+	if (UAbilityDefinition** Existing = Definitions.Find(Data))
+	{
+		return *Existing;
+	}
+
+	UAbilityDefinition* Definition = NewObject<UAbilityDefinition>(this);
+	Definition->Compile(Data);
+	Definitions.Add(Data, Definition);
+
+	return Definition;
+}
@@ -0,0 +1,143 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/ActorPoolSubsystem.h"
+#include "Core/Poolable.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+AActor* UActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator)
+{
+	return AcquireActor(ActorClass, Location, Rotation, Owner, Instigator, [](AActor*) {});
+}
+
+AActor* UActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Setup)
+{
+	if (!ActorClass)
+		return nullptr;
+
+	UWorld* World = GetWorld();
+	if (!World)
+		return nullptr;
+
+	// Try to reuse from pool
+	if (FActorPoolBucket* Bucket = Buckets.Find(ActorClass))
+	{
+		while (Bucket->InactiveActors.Num() > 0)
+		{
+			AActor* Actor = Bucket->InactiveActors.Pop(EAllowShrinking::No);
+			if (!IsValid(Actor))
+				continue;
+
+			PoolHits++;
+
+			Actor->SetOwner(Owner);
+			Actor->SetInstigator(Instigator);
+			Actor->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+			Actor->SetActorHiddenInGame(false);
+			Actor->SetActorEnableCollision(true);
+			Actor->SetActorTickEnabled(true);
+
+			Setup(Actor);
+			CastChecked<IPoolable>(Actor)->OnAcquiredFromPool();
+			return Actor;
+		}
+	}
+
+	// Pool is empty, spawn new actor
+	PoolMisses++;
+
+	return SpawnDeferred(World, ActorClass, Location, Rotation, Owner, Instigator, Setup);
+}
+
+AActor* UActorPoolSubsystem::AcquireOrSpawn(UWorld* World, TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Setup)
+{
+	if (!World || !ActorClass)
+		return nullptr;
+
+	if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+	{
+		return Pool->AcquireActor(ActorClass, Location, Rotation, Owner, Instigator, Setup);
+	}
+
+	return SpawnDeferred(World, ActorClass, Location, Rotation, Owner, Instigator, Setup);
+}
+
+AActor* UActorPoolSubsystem::SpawnDeferred(UWorld* World, TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Setup)
+{
+	// Deferred so Setup runs before BeginPlay, the same point as on reuse
+	const FTransform SpawnTransform(Rotation, Location);
+	AActor* Actor = World->SpawnActorDeferred<AActor>(ActorClass, SpawnTransform, Owner, Instigator, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Actor)
+		return nullptr;
+
+	Setup(Actor);
+	Actor->FinishSpawning(SpawnTransform);
+	return Actor;
+}
+
+void UActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+		return;
+
+	IPoolable* Poolable = Cast<IPoolable>(Actor);
+	if (!Poolable)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	FActorPoolBucket& Bucket = Buckets.FindOrAdd(Actor->GetClass());
+
+	// Released twice (e.g. hit and lifetime in the same frame) - pooling it again would hand it out twice
+	if (Bucket.InactiveActors.Contains(Actor))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ActorPoolSubsystem: %s is already in the pool, ignoring ReleaseActor"), *Actor->GetName());
+		return;
+	}
+
+	if (Bucket.InactiveActors.Num() >= MaxPooledPerClass)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	Poolable->OnReturnedToPool();
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->SetOwner(nullptr);
+
+	Bucket.InactiveActors.Add(Actor);
+}
+
+void UActorPoolSubsystem::ReleaseOrDestroy(AActor* Actor)
+{
+	if (!IsValid(Actor))
+		return;
+
+	UWorld* World = Actor->GetWorld();
+	UActorPoolSubsystem* Pool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr;
+	if (Pool)
+	{
+		Pool->ReleaseActor(Actor);
+	}
+	else
+	{
+		Actor->Destroy();
+	}
+}
+
+int32 UActorPoolSubsystem::GetPooledCount(TSubclassOf<AActor> ActorClass) const
+{
+	const FActorPoolBucket* Bucket = Buckets.Find(ActorClass);
+	return Bucket ? Bucket->InactiveActors.Num() : 0;
+}
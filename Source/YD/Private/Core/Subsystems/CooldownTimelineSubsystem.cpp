@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/CooldownTimelineSubsystem.h"
+#include "Gameplay/Data/Ability.h"
+#include "GameFramework/GameStateBase.h"
+#include "Engine/World.h"
+
+void UCooldownTimelineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Timeline.Reserve(64);
+}
+
+void UCooldownTimelineSubsystem::Deinitialize()
+{
+	Timeline.Empty();
+
+	Super::Deinitialize();
+}
+
+void UCooldownTimelineSubsystem::Tick(float DeltaTime)
+{
+	if (Timeline.Num() == 0)
+		return;
+
+	const double Now = GetTime();
+
+	while (Timeline.Num() > 0 && Timeline.HeapTop().ExpireTime <= Now)
+	{
+		FCooldownEntry Entry;
+		Timeline.HeapPop(Entry, FEarlierExpiry(), EAllowShrinking::No);
+
+		// Destroyed ability or a cooldown that was restarted/cancelled since this entry was pushed
+		UAbility* Ability = Entry.Ability.Get();
+		if (!Ability || Ability->CooldownSerial != Entry.Serial)
+			continue;
+
+		// May schedule the next charge, which lands back in the heap
+		Ability->OnCooldownExpired();
+	}
+}
+
+double UCooldownTimelineSubsystem::GetTime() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return 0.0;
+
+	// Same clock on server and clients so replicated end times can be read directly
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return World->GetTimeSeconds();
+}
+
+void UCooldownTimelineSubsystem::Schedule(UAbility* Ability, double ExpireTime, uint32 Serial)
+{
+	if (!Ability)
+		return;
+
+	FCooldownEntry Entry;
+	Entry.ExpireTime = ExpireTime;
+	Entry.Ability = Ability;
+	Entry.Serial = Serial;
+	Timeline.HeapPush(Entry, FEarlierExpiry());
+}
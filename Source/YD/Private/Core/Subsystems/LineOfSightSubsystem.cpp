@@ -0,0 +1,235 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/LineOfSightSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+
+void ULineOfSightSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CacheCellSize = 100.f;
+	CacheTTL = 0.25f;
+	MaxTracesPerFrame = 64;
+	PruneTimer = 0.f;
+	CacheHits = 0;
+	CacheMisses = 0;
+	TracesIssued = 0;
+
+	UE_LOG(LogTemp, Log, TEXT("LineOfSightSubsystem: Initialized (CellSize: %.1f, TTL: %.2fs)"), CacheCellSize, CacheTTL);
+}
+
+void ULineOfSightSubsystem::Deinitialize()
+{
+	ClearCache();
+
+	Super::Deinitialize();
+}
+
+void ULineOfSightSubsystem::Tick(float DeltaTime)
+{
+	// Results of last frame's traces first, so this frame's queries can hit them
+	CollectFinishedTraces();
+	IssueQueuedTraces();
+
+	PruneTimer += DeltaTime;
+	if (PruneTimer >= 1.f)
+	{
+		PruneTimer = 0.f;
+		PruneExpired();
+	}
+}
+
+ELineOfSightResult ULineOfSightSubsystem::QueryLineOfSight(const AActor* From, const AActor* To)
+{
+	if (!From || !To)
+		return ELineOfSightResult::Blocked;
+
+	const FVector Start = From->GetActorLocation();
+	const FVector End = To->GetActorLocation();
+	const FLineOfSightKey Key = MakeKey(Start, End);
+
+	if (const FCachedResult* Cached = FindValid(Key))
+	{
+		CacheHits++;
+		return Cached->bVisible ? ELineOfSightResult::Visible : ELineOfSightResult::Blocked;
+	}
+
+	CacheMisses++;
+
+	// Queue once per pair; the trace is issued on the next tick
+	bool bAlreadyPending = false;
+	PendingKeys.Add(Key, &bAlreadyPending);
+	if (!bAlreadyPending)
+	{
+		FTraceRequest& Request = QueuedRequests.AddDefaulted_GetRef();
+		Request.Key = Key;
+		Request.Start = Start;
+		Request.End = End;
+		Request.From = From;
+		Request.To = To;
+	}
+
+	return ELineOfSightResult::Pending;
+}
+
+bool ULineOfSightSubsystem::HasLineOfSightSync(const AActor* From, const AActor* To)
+{
+	if (!From || !To)
+		return false;
+
+	UWorld* World = GetWorld();
+	if (!World)
+		return false;
+
+	const FVector Start = From->GetActorLocation();
+	const FVector End = To->GetActorLocation();
+	const FLineOfSightKey Key = MakeKey(Start, End);
+
+	if (const FCachedResult* Cached = FindValid(Key))
+	{
+		CacheHits++;
+		return Cached->bVisible;
+	}
+
+	CacheMisses++;
+
+	FHitResult HitResult;
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(From);
+	QueryParams.AddIgnoredActor(To);
+
+	const bool bHit = World->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
+	TracesIssued++;
+
+	StoreResult(Key, !bHit);
+	return !bHit;
+}
+
+void ULineOfSightSubsystem::ClearCache()
+{
+	Cache.Empty();
+	PendingKeys.Empty();
+	QueuedRequests.Empty();
+	InFlightTraces.Empty();
+}
+
+FLineOfSightKey ULineOfSightSubsystem::MakeKey(const FVector& From, const FVector& To) const
+{
+	const float InvCellSize = 1.f / FMath::Max(CacheCellSize, 1.f);
+
+	FLineOfSightKey Key;
+	Key.FromCell = FIntVector(FMath::FloorToInt(From.X * InvCellSize), FMath::FloorToInt(From.Y * InvCellSize), FMath::FloorToInt(From.Z * InvCellSize));
+	Key.ToCell = FIntVector(FMath::FloorToInt(To.X * InvCellSize), FMath::FloorToInt(To.Y * InvCellSize), FMath::FloorToInt(To.Z * InvCellSize));
+	return Key;
+}
+
+const ULineOfSightSubsystem::FCachedResult* ULineOfSightSubsystem::FindValid(const FLineOfSightKey& Key) const
+{
+	const FCachedResult* Cached = Cache.Find(Key);
+	if (!Cached)
+		return nullptr;
+
+	const UWorld* World = GetWorld();
+	if (!World || World->GetTimeSeconds() > Cached->ExpireTime)
+		return nullptr;
+
+	return Cached;
+}
+
+void ULineOfSightSubsystem::StoreResult(const FLineOfSightKey& Key, bool bVisible)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	FCachedResult& Cached = Cache.FindOrAdd(Key);
+	Cached.bVisible = bVisible;
+	Cached.ExpireTime = World->GetTimeSeconds() + CacheTTL;
+}
+
+void ULineOfSightSubsystem::CollectFinishedTraces()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	for (int32 i = InFlightTraces.Num() - 1; i >= 0; --i)
+	{
+		const FInFlightTrace& Trace = InFlightTraces[i];
+
+		FTraceDatum Datum;
+		if (World->QueryTraceData(Trace.Handle, Datum))
+		{
+			// Any blocking hit on the visibility channel means the view is blocked
+			bool bBlocked = false;
+			for (const FHitResult& Hit : Datum.OutHits)
+			{
+				if (Hit.bBlockingHit)
+				{
+					bBlocked = true;
+					break;
+				}
+			}
+
+			StoreResult(Trace.Key, !bBlocked);
+		}
+		else if (World->IsTraceHandleValid(Trace.Handle, false))
+		{
+			// Not finished yet
+			continue;
+		}
+
+		// Done or expired - an expired pair is simply requested again by the next query
+		PendingKeys.Remove(Trace.Key);
+		InFlightTraces.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+}
+
+void ULineOfSightSubsystem::IssueQueuedTraces()
+{
+	UWorld* World = GetWorld();
+	if (!World || QueuedRequests.Num() == 0)
+		return;
+
+	const int32 NumToIssue = FMath::Min(QueuedRequests.Num(), FMath::Max(1, MaxTracesPerFrame));
+	for (int32 i = 0; i < NumToIssue; i++)
+	{
+		const FTraceRequest& Request = QueuedRequests[i];
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(YDLineOfSight));
+		if (const AActor* From = Request.From.Get())
+		{
+			QueryParams.AddIgnoredActor(From);
+		}
+		if (const AActor* To = Request.To.Get())
+		{
+			QueryParams.AddIgnoredActor(To);
+		}
+
+		FInFlightTrace& Trace = InFlightTraces.AddDefaulted_GetRef();
+		Trace.Key = Request.Key;
+		Trace.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, ECC_Visibility, QueryParams);
+		TracesIssued++;
+	}
+
+	// Leftovers keep their pending flag and go out next frame
+	QueuedRequests.RemoveAt(0, NumToIssue, EAllowShrinking::No);
+}
+
+void ULineOfSightSubsystem::PruneExpired()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	const double Now = World->GetTimeSeconds();
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (Now > It.Value().ExpireTime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -1,19 +1,107 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Core/Subsystems/MinionBatchProcessor.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
+#include "Core/Subsystems/MinionFlowFieldSubsystem.h"
+#include "Core/Subsystems/LineOfSightSubsystem.h"
 #include "Gameplay/Characters/Enemy/Enemy_Base.h"
 #include "Gameplay/Components/CharacterStatComponent.h"
 #include "Gameplay/Components/CombatComponent.h"
+#include "Gameplay/Components/TeamComponent.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
+#include "GameFramework/Controller.h"
 #include "Engine/World.h"
-#include "Engine/OverlapResult.h"
+#include "Async/ParallelFor.h"
+
+// ============================================
+// Packed Tables
+// ============================================
+
+void FMinionStateTable::AddRow(uint8 InTeam, float InDetectionRange, bool bInNeedsLineOfSight)
+{
+	PositionX.Add(0.f);
+	PositionY.Add(0.f);
+	PositionZ.Add(0.f);
+	Team.Add(InTeam);
+	bAlive.Add(1);
+	TargetIndex.Add(INDEX_NONE);
+	AttackRange.Add(0.f);
+	DetectionRange.Add(InDetectionRange);
+	bNeedsLineOfSight.Add(bInNeedsLineOfSight ? 1 : 0);
+	MoveState.Add(EMinionMoveState::Idle);
+	MoveTimer.Add(0.f);
+}
+
+void FMinionStateTable::RemoveRowSwap(int32 Row)
+{
+	PositionX.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	PositionY.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	PositionZ.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	Team.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	bAlive.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	TargetIndex.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	AttackRange.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	DetectionRange.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	bNeedsLineOfSight.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	MoveState.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	MoveTimer.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+}
+
+void FMinionStateTable::Reset()
+{
+	PositionX.Reset();
+	PositionY.Reset();
+	PositionZ.Reset();
+	Team.Reset();
+	bAlive.Reset();
+	TargetIndex.Reset();
+	AttackRange.Reset();
+	DetectionRange.Reset();
+	bNeedsLineOfSight.Reset();
+	MoveState.Reset();
+	MoveTimer.Reset();
+}
+
+void FMinionTargetTable::Reset()
+{
+	Actors.Reset();
+	PositionX.Reset();
+	PositionY.Reset();
+	PositionZ.Reset();
+	Team.Reset();
+	bAlive.Reset();
+	FilledPass.Reset();
+	Pass = 0;
+}
+
+void FMinionTargetTable::BeginPass(int32 NumEntries)
+{
+	Actors.SetNum(NumEntries, EAllowShrinking::No);
+	PositionX.SetNum(NumEntries, EAllowShrinking::No);
+	PositionY.SetNum(NumEntries, EAllowShrinking::No);
+	PositionZ.SetNum(NumEntries, EAllowShrinking::No);
+	Team.SetNum(NumEntries, EAllowShrinking::No);
+	bAlive.SetNum(NumEntries, EAllowShrinking::No);
+	FilledPass.SetNum(NumEntries, EAllowShrinking::No);
+	Pass++;
+}
+
+// ============================================
+// Subsystem
+// ============================================
 
 void UMinionBatchProcessor::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	TargetUpdateTimer = 0.f;
-	TargetUpdateInterval = 0.5f; // Update targets every 0.5 seconds
+	TargetUpdateInterval = 0.5f; // Every idle minion searches at least every 0.5 seconds
+	TargetBudgetMicroseconds = 500.f;
+	RoundRobinCursor = 0;
+	RoundRobinAccumulator = 0.f;
+	bDriveMinionMovement = false;
+	MoveUpdateInterval = 0.2f;
+	bParallelTargetSearch = true;
+	TargetSearchChunkSize = 32;
 
 	UE_LOG(LogTemp, Log, TEXT("MinionBatchProcessor: Initialized"));
 }
@@ -21,6 +109,14 @@ void UMinionBatchProcessor::Initialize(FSubsystemCollectionBase& Collection)
 void UMinionBatchProcessor::Deinitialize()
 {
 	RegisteredMinions.Empty();
+	MinionRows.Reset();
+	MinionCombat.Empty();
+	MinionStats.Empty();
+	MinionTable.Reset();
+	TargetTable.Reset();
+	SearchRows.Empty();
+	SearchResults.Empty();
+	TargetStatsCache.Empty();
 	Super::Deinitialize();
 }
 
@@ -29,21 +125,47 @@ void UMinionBatchProcessor::Tick(float DeltaTime)
 	if (RegisteredMinions.Num() == 0)
 		return;
 
-	// Update target search timer
-	TargetUpdateTimer += DeltaTime;
-	if (TargetUpdateTimer >= TargetUpdateInterval)
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	// Per-minion radius queries against the spatial hash instead of one big physics overlap
+	USpatialHashSubsystem* SpatialHash = World->GetSubsystem<USpatialHashSubsystem>();
+	if (!SpatialHash)
+		return;
+
+	// Movement reads every row - otherwise only the rows searched this frame are synced
+	if (bDriveMinionMovement)
 	{
-		TargetUpdateTimer = 0.f;
-		BatchUpdateTargets();
+		SyncMinionTable();
+	}
+
+	// Spread target searches over frames instead of re-targeting everyone every interval
+	BatchUpdateTargets(DeltaTime, SpatialHash);
+
+	if (bDriveMinionMovement)
+	{
+		UpdateMinionMovement(DeltaTime);
 	}
 }
 
 void UMinionBatchProcessor::RegisterMinion(AEnemy_Base* Minion)
 {
-	if (!Minion || RegisteredMinions.Contains(Minion))
+	if (!Minion || MinionRows.Contains(Minion))
 		return;
 
+	MinionRows.Add(Minion);
 	RegisteredMinions.Add(Minion);
+	MinionCombat.Add(Minion->FindComponentByClass<UCombatComponent>());
+	MinionStats.Add(Minion->FindComponentByClass<UCharacterStatComponent>());
+	MinionTable.AddRow(GetTeamId(Minion), Minion->GetDetectionRange(), Minion->DoesDetectionRequireLineOfSight());
+
+	// The processor runs this minion's state machine, so skip its per-actor tick
+	if (bDriveMinionMovement)
+	{
+		Minion->SetActorTickEnabled(false);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("MinionBatchProcessor: Registered minion. Total: %d"), RegisteredMinions.Num());
 }
 
@@ -52,125 +174,469 @@ void UMinionBatchProcessor::UnregisterMinion(AEnemy_Base* Minion)
 	if (!Minion)
 		return;
 
-	RegisteredMinions.Remove(Minion);
+	const int32 Row = MinionRows.Remove(Minion);
+	if (Row == INDEX_NONE)
+		return;
+
+	// Swap-remove every column so rows stay aligned
+	RegisteredMinions.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	MinionCombat.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	MinionStats.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	MinionTable.RemoveRowSwap(Row);
+
+	if (bDriveMinionMovement)
+	{
+		Minion->SetActorTickEnabled(true);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("MinionBatchProcessor: Unregistered minion. Total: %d"), RegisteredMinions.Num());
 }
 
-void UMinionBatchProcessor::BatchUpdateTargets()
+void UMinionBatchProcessor::SetDriveMinionMovement(bool bEnable)
 {
-	if (RegisteredMinions.Num() == 0)
+	if (bDriveMinionMovement == bEnable)
 		return;
 
-	UWorld* World = GetWorld();
-	if (!World)
-		return;
+	bDriveMinionMovement = bEnable;
 
-	// Single sphere overlap for all minions
-	// Use a large sphere that encompasses all minion detection ranges
-	FVector CenterPoint = FVector::ZeroVector;
-	int32 ValidMinions = 0;
-
-	// Calculate center of all minions
-	for (AEnemy_Base* Minion : RegisteredMinions)
+	for (int32 Row = 0; Row < RegisteredMinions.Num(); Row++)
 	{
-		if (Minion && IsValid(Minion))
+		if (AEnemy_Base* Minion = RegisteredMinions[Row])
 		{
-			CenterPoint += Minion->GetActorLocation();
-			ValidMinions++;
+			Minion->SetActorTickEnabled(!bEnable);
 		}
+		MinionTable.MoveState[Row] = EMinionMoveState::Idle;
+		MinionTable.MoveTimer[Row] = 0.f;
 	}
+}
+
+uint8 UMinionBatchProcessor::GetTeamId(const AActor* Actor)
+{
+	return UTeamComponent::GetTeamId(Actor);
+}
 
-	if (ValidMinions == 0)
+void UMinionBatchProcessor::SyncMinionTable()
+{
+	for (int32 Row = 0; Row < RegisteredMinions.Num(); Row++)
+	{
+		SyncMinionRow(Row);
+	}
+}
+
+void UMinionBatchProcessor::SyncMinionRow(int32 Row)
+{
+	AEnemy_Base* Minion = RegisteredMinions[Row];
+	if (!IsValid(Minion))
+	{
+		MinionTable.bAlive[Row] = 0;
 		return;
+	}
+
+	const FVector Location = Minion->GetActorLocation();
+	MinionTable.PositionX[Row] = Location.X;
+	MinionTable.PositionY[Row] = Location.Y;
+	MinionTable.PositionZ[Row] = Location.Z;
 
-	CenterPoint /= ValidMinions;
+	UCharacterStatComponent* Stats = MinionStats[Row];
+	MinionTable.bAlive[Row] = (!Stats || Stats->IsAlive()) ? 1 : 0;
+	MinionTable.AttackRange[Row] = Stats ? Stats->GetCurrentAttackRange() : 150.f;
+	MinionTable.DetectionRange[Row] = Minion->GetDetectionRange();
+	MinionTable.bNeedsLineOfSight[Row] = Minion->DoesDetectionRequireLineOfSight() ? 1 : 0;
+}
 
-	// Perform large overlap to find all potential targets
-	TArray<FOverlapResult> OverlapResults;
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(5000.f); // Large radius
-	FCollisionQueryParams QueryParams;
-	for (AEnemy_Base* Minion : RegisteredMinions)
+bool UMinionBatchProcessor::IsMinionAlive(int32 Row) const
+{
+	const UCharacterStatComponent* Stats = MinionStats[Row];
+	return IsValid(RegisteredMinions[Row]) && (!Stats || Stats->IsAlive());
+}
+
+UCharacterStatComponent* UMinionBatchProcessor::FindTargetStats(AActor* Actor)
+{
+	if (!Actor)
+		return nullptr;
+
+	// One cached component lookup per candidate, instead of per minion per candidate
+	TWeakObjectPtr<UCharacterStatComponent>& CachedStats = TargetStatsCache.FindOrAdd(Actor);
+	if (!CachedStats.IsValid())
 	{
-		QueryParams.AddIgnoredActor(Minion);
+		CachedStats = Actor->FindComponentByClass<UCharacterStatComponent>();
 	}
+	return CachedStats.Get();
+}
 
-	World->OverlapMultiByChannel(
-		OverlapResults,
-		CenterPoint,
-		FQuat::Identity,
-		ECC_Pawn,
-		Sphere,
-		QueryParams
-	);
+void UMinionBatchProcessor::FillTargetTable(const USpatialHashSubsystem* SpatialHash, int32 Start, int32 End)
+{
+	for (int32 i = Start; i < End; i++)
+	{
+		const int32 Row = SearchRows[i];
+		const FVector Center(MinionTable.PositionX[Row], MinionTable.PositionY[Row], MinionTable.PositionZ[Row]);
+
+		// Same cells FindClosestEnemy visits, so every entry it reads is filled for this pass
+		SpatialHash->ForEachEntryNear(Center, MinionTable.DetectionRange[Row], [this, SpatialHash](int32 EntryIndex)
+		{
+			if (TargetTable.FilledPass[EntryIndex] == TargetTable.Pass)
+				return;
+
+			AActor* Actor = SpatialHash->GetEntryActor(EntryIndex);
+			const FVector& Location = SpatialHash->GetEntryLocation(EntryIndex);
+			UCharacterStatComponent* Stats = FindTargetStats(Actor);
+
+			TargetTable.Actors[EntryIndex] = Actor;
+			TargetTable.PositionX[EntryIndex] = Location.X;
+			TargetTable.PositionY[EntryIndex] = Location.Y;
+			TargetTable.PositionZ[EntryIndex] = Location.Z;
+			TargetTable.Team[EntryIndex] = GetTeamId(Actor);
+			TargetTable.bAlive[EntryIndex] = (Stats && Stats->IsAlive()) ? 1 : 0;
+			TargetTable.FilledPass[EntryIndex] = TargetTable.Pass;
+		});
+	}
+}
 
-	// Assign closest enemy to each minion
-	for (AEnemy_Base* Minion : RegisteredMinions)
+void UMinionBatchProcessor::BatchUpdateTargets(float DeltaTime, const USpatialHashSubsystem* SpatialHash)
+{
+	SchedulerStats.MinionsProcessedLastFrame = 0;
+	SchedulerStats.PriorityProcessedLastFrame = 0;
+	SchedulerStats.DeferredLastFrame = 0;
+
+	const int32 NumMinions = RegisteredMinions.Num();
+	if (NumMinions == 0)
+		return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// How many idle minions to visit this frame so each one is revisited every TargetUpdateInterval
+	RoundRobinAccumulator += NumMinions * DeltaTime / FMath::Max(TargetUpdateInterval, KINDA_SMALL_NUMBER);
+	const int32 RoundRobinQuota = FMath::Min(FMath::FloorToInt(RoundRobinAccumulator), NumMinions);
+	RoundRobinAccumulator -= RoundRobinQuota;
+
+	// Minions whose target just died go first, then idle minions in round-robin order
+	SearchRows.Reset();
+	int32 NumPriority = 0;
+
+	TArray<int32, TInlineAllocator<256>> IdleRows;
+	if (RoundRobinCursor >= NumMinions)
 	{
-		if (!Minion || !IsValid(Minion))
+		RoundRobinCursor = 0;
+	}
+
+	for (int32 Offset = 0; Offset < NumMinions; Offset++)
+	{
+		const int32 Row = (RoundRobinCursor + Offset) % NumMinions;
+		if (!IsMinionAlive(Row))
 			continue;
 
-		UCombatComponent* Combat = Minion->FindComponentByClass<UCombatComponent>();
+		UCombatComponent* Combat = MinionCombat[Row];
 		if (!Combat)
 			continue;
 
-		// Skip if already has a valid target
-		if (Combat->GetTarget() && IsValid(Combat->GetTarget()))
+		AActor* CurrentTarget = Combat->GetTarget();
+		if (CurrentTarget)
+		{
+			// Skip if already has a valid target
+			if (IsValid(CurrentTarget))
+			{
+				UCharacterStatComponent* TargetStats = FindTargetStats(CurrentTarget);
+				if (TargetStats && TargetStats->IsAlive())
+					continue; // Keep current target
+			}
+
+			// Target just died or became invalid - search immediately
+			SearchRows.Add(Row);
+			NumPriority++;
+		}
+		else if (IdleRows.Num() < RoundRobinQuota)
+		{
+			IdleRows.Add(Row);
+		}
+	}
+
+	SearchRows.Append(IdleRows);
+
+	for (int32 Row : SearchRows)
+	{
+		SyncMinionRow(Row);
+	}
+
+	// Drop cached stats for actors that have left the hash
+	if (TargetStatsCache.Num() > SpatialHash->GetNumEntries() * 2 + 64)
+	{
+		TargetStatsCache.Reset();
+	}
+
+	TargetTable.BeginPass(SpatialHash->GetNumEntries());
+
+	// Process in chunks until the work or the budget runs out
+	const int32 NumSearches = SearchRows.Num();
+	const int32 ChunkSize = FMath::Max(1, TargetSearchChunkSize);
+	const double BudgetSeconds = TargetBudgetMicroseconds * 1e-6;
+	int32 Processed = 0;
+
+	while (Processed < NumSearches)
+	{
+		const int32 ChunkEnd = FMath::Min(Processed + ChunkSize, NumSearches);
+		FillTargetTable(SpatialHash, Processed, ChunkEnd);
+		SearchTargets(SpatialHash, Processed, ChunkEnd);
+		ApplyTargets(SpatialHash, Processed, ChunkEnd);
+		Processed = ChunkEnd;
+
+		if (Processed < NumSearches && FPlatformTime::Seconds() - StartTime > BudgetSeconds)
+		{
+			SchedulerStats.BudgetOverruns++;
+			break;
+		}
+	}
+
+	// Continue the round-robin after the last idle minion that actually got processed
+	if (Processed > NumPriority)
+	{
+		RoundRobinCursor = (SearchRows[Processed - 1] + 1) % NumMinions;
+	}
+
+	const float ElapsedMicroseconds = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1e6);
+	SchedulerStats.MinionsProcessedLastFrame = Processed;
+	SchedulerStats.PriorityProcessedLastFrame = FMath::Min(Processed, NumPriority);
+	SchedulerStats.DeferredLastFrame = NumSearches - Processed;
+	SchedulerStats.LastFrameMicroseconds = ElapsedMicroseconds;
+	SchedulerStats.PeakFrameMicroseconds = FMath::Max(SchedulerStats.PeakFrameMicroseconds, ElapsedMicroseconds);
+}
+
+void UMinionBatchProcessor::SearchTargets(const USpatialHashSubsystem* SpatialHash, int32 Start, int32 End)
+{
+	SearchResults.SetNumUninitialized(SearchRows.Num(), EAllowShrinking::No);
+
+	const int32 NumSearches = End - Start;
+	if (NumSearches <= 0)
+		return;
+
+	// Each task only reads the packed tables and the hash, and writes its own SearchResults slots
+	const int32 ChunkSize = FMath::Max(1, TargetSearchChunkSize / 4);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumSearches, ChunkSize);
+	const EParallelForFlags Flags = bParallelTargetSearch ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+	ParallelFor(NumChunks, [this, SpatialHash, ChunkSize, Start, End](int32 ChunkIndex)
+	{
+		const int32 ChunkStart = Start + ChunkIndex * ChunkSize;
+		const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, End);
+
+		for (int32 i = ChunkStart; i < ChunkEnd; i++)
+		{
+			SearchResults[i] = FindClosestEnemy(SearchRows[i], SpatialHash);
+		}
+	}, Flags);
+}
+
+void UMinionBatchProcessor::ApplyTargets(const USpatialHashSubsystem* SpatialHash, int32 Start, int32 End)
+{
+	// Minions chasing the same target share one flow field instead of one path query each
+	UMinionFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UMinionFlowFieldSubsystem>();
+	ULineOfSightSubsystem* LineOfSight = GetWorld()->GetSubsystem<ULineOfSightSubsystem>();
+
+	// Row order, so side effects happen in the same order as the serial path
+	for (int32 i = Start; i < End; i++)
+	{
+		const int32 Row = SearchRows[i];
+		int32 ClosestIndex = SearchResults[i];
+
+		// Same rule as the per-actor detection strategy: skip enemies behind walls
+		if (ClosestIndex != INDEX_NONE && MinionTable.bNeedsLineOfSight[Row] && LineOfSight)
 		{
-			UCharacterStatComponent* TargetStats = Combat->GetTarget()->FindComponentByClass<UCharacterStatComponent>();
-			if (TargetStats && TargetStats->IsAlive())
-				continue; // Keep current target
+			ClosestIndex = FindClosestVisibleEnemy(Row, ClosestIndex, SpatialHash, LineOfSight);
 		}
 
-		// Find new closest enemy
-		AActor* ClosestEnemy = FindClosestEnemy(Minion, OverlapResults);
-		if (ClosestEnemy && Combat)
+		if (ClosestIndex == INDEX_NONE)
 		{
-			Combat->SetTarget(ClosestEnemy);
+			// Drop a dead target so the minion goes back to the idle round-robin instead of being prioritized every frame
+			MinionTable.TargetIndex[Row] = INDEX_NONE;
+			MinionCombat[Row]->SetTarget(nullptr);
+			continue;
+		}
+
+		AActor* ClosestEnemy = TargetTable.Actors[ClosestIndex];
+		MinionTable.TargetIndex[Row] = ClosestIndex;
+		MinionCombat[Row]->SetTarget(ClosestEnemy);
 
-			// Move towards target
-			if (AController* Controller = Minion->GetController())
+		// Move towards target
+		if (AController* Controller = RegisteredMinions[Row]->GetController())
+		{
+			if (FlowField)
+			{
+				FlowField->MoveToActor(Controller, ClosestEnemy);
+			}
+			else
 			{
 				UAIBlueprintHelperLibrary::SimpleMoveToActor(Controller, ClosestEnemy);
 			}
+			MinionTable.MoveState[Row] = EMinionMoveState::Chasing;
+			MinionTable.MoveTimer[Row] = 0.f;
 		}
 	}
 }
 
-AActor* UMinionBatchProcessor::FindClosestEnemy(AEnemy_Base* Minion, const TArray<FOverlapResult>& PotentialTargets) const
+void UMinionBatchProcessor::UpdateMinionMovement(float DeltaTime)
 {
-	if (!Minion)
-		return nullptr;
-
-	float DetectionRange = 800.f; // Same as Enemy_Base
-	AActor* ClosestEnemy = nullptr;
-	float ClosestDistance = DetectionRange;
+	UMinionFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UMinionFlowFieldSubsystem>();
 
-	FVector MinionLocation = Minion->GetActorLocation();
-
-	for (const FOverlapResult& Result : PotentialTargets)
+	for (int32 Row = 0; Row < RegisteredMinions.Num(); Row++)
 	{
-		AActor* Target = Result.GetActor();
-		if (!Target || Target == Minion)
+		if (!MinionTable.bAlive[Row])
 			continue;
 
-		// Check if enemy
-		if (!Minion->IsEnemy(Target))
+		AEnemy_Base* Minion = RegisteredMinions[Row];
+		UCombatComponent* Combat = MinionCombat[Row];
+		if (!Minion || !Combat)
 			continue;
 
-		// Check if alive
-		UCharacterStatComponent* TargetStats = Target->FindComponentByClass<UCharacterStatComponent>();
-		if (!TargetStats || !TargetStats->IsAlive())
+		AController* Controller = Minion->GetController();
+		if (!Controller)
 			continue;
 
-		// Check distance
-		float Distance = FVector::Dist(MinionLocation, Target->GetActorLocation());
-		if (Distance < ClosestDistance)
+		// Get current target (either combat target or movement target)
+		AActor* CurrentTargetActor = Combat->GetTarget();
+		if (!CurrentTargetActor)
 		{
-			ClosestDistance = Distance;
-			ClosestEnemy = Target;
+			CurrentTargetActor = Minion->GetMovementTarget();
+		}
+
+		if (!CurrentTargetActor)
+		{
+			MinionTable.MoveState[Row] = EMinionMoveState::Idle;
+			continue;
+		}
+
+		// Packed position when the target was copied this pass, actor location otherwise
+		FVector TargetLocation;
+		const int32 TargetIndex = MinionTable.TargetIndex[Row];
+		if (TargetTable.IsFilled(TargetIndex) && TargetTable.Actors[TargetIndex] == CurrentTargetActor)
+		{
+			TargetLocation = FVector(TargetTable.PositionX[TargetIndex], TargetTable.PositionY[TargetIndex], TargetTable.PositionZ[TargetIndex]);
+		}
+		else
+		{
+			TargetLocation = CurrentTargetActor->GetActorLocation();
+		}
+
+		const float DeltaX = TargetLocation.X - MinionTable.PositionX[Row];
+		const float DeltaY = TargetLocation.Y - MinionTable.PositionY[Row];
+		const float DeltaZ = TargetLocation.Z - MinionTable.PositionZ[Row];
+		const float DistSquared = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+		const float AttackRange = MinionTable.AttackRange[Row];
+
+		if (DistSquared <= AttackRange * AttackRange)
+		{
+			// In range - set as combat target if not already
+			if (!Combat->GetTarget())
+			{
+				Combat->SetTarget(CurrentTargetActor);
+			}
+
+			// Stop once on entering range instead of re-issuing a stop every frame
+			if (MinionTable.MoveState[Row] != EMinionMoveState::InRange)
+			{
+				if (FlowField)
+				{
+					FlowField->StopMovement(Controller);
+				}
+				else
+				{
+					Controller->StopMovement();
+				}
+				MinionTable.MoveState[Row] = EMinionMoveState::InRange;
+			}
+		}
+		else
+		{
+			// Not in range - only re-path every MoveUpdateInterval
+			MinionTable.MoveTimer[Row] += DeltaTime;
+
+			if (MinionTable.MoveState[Row] != EMinionMoveState::Chasing || MinionTable.MoveTimer[Row] >= MoveUpdateInterval)
+			{
+				MinionTable.MoveTimer[Row] = 0.f;
+				MinionTable.MoveState[Row] = EMinionMoveState::Chasing;
+				if (FlowField)
+				{
+					FlowField->MoveToActor(Controller, CurrentTargetActor);
+				}
+				else
+				{
+					UAIBlueprintHelperLibrary::SimpleMoveToActor(Controller, CurrentTargetActor);
+				}
+			}
 		}
 	}
+}
 
-	return ClosestEnemy;
+void UMinionBatchProcessor::GatherEnemyCandidates(int32 MinionRow, const USpatialHashSubsystem* SpatialHash, TSoAPositions<64>& OutPositions, TArray<int32, TInlineAllocator<64>>& OutEntries) const
+{
+	const FVector Center(MinionTable.PositionX[MinionRow], MinionTable.PositionY[MinionRow], MinionTable.PositionZ[MinionRow]);
+	const uint8 MinionTeam = MinionTable.Team[MinionRow];
+	const AActor* Self = RegisteredMinions[MinionRow];
+
+	SpatialHash->ForEachEntryNear(Center, MinionTable.DetectionRange[MinionRow], [&](int32 EntryIndex)
+	{
+		// Enemy = different team, same rule as AEnemy_Base::IsEnemy
+		if (TargetTable.Team[EntryIndex] == MinionTeam || !TargetTable.bAlive[EntryIndex] || TargetTable.Actors[EntryIndex] == Self)
+			return;
+
+		OutPositions.Add(TargetTable.PositionX[EntryIndex], TargetTable.PositionY[EntryIndex], TargetTable.PositionZ[EntryIndex]);
+		OutEntries.Add(EntryIndex);
+	});
 }
 
+int32 UMinionBatchProcessor::FindClosestEnemy(int32 MinionRow, const USpatialHashSubsystem* SpatialHash) const
+{
+	if (!SpatialHash)
+		return INDEX_NONE;
+
+	const FVector3f MinionLocation(MinionTable.PositionX[MinionRow], MinionTable.PositionY[MinionRow], MinionTable.PositionZ[MinionRow]);
+	const float DetectionRange = MinionTable.DetectionRange[MinionRow];
+
+	// Gather enemy candidates from the nearby cells into SoA, then one SIMD argmin over them
+	TSoAPositions<64> Candidates;
+	TArray<int32, TInlineAllocator<64>> CandidateEntries;
+	GatherEnemyCandidates(MinionRow, SpatialHash, Candidates, CandidateEntries);
+
+	const int32 Nearest = Candidates.FindNearest(MinionLocation, DetectionRange * DetectionRange);
+	const int32 ClosestIndex = Nearest != INDEX_NONE ? CandidateEntries[Nearest] : INDEX_NONE;
+
+	return ClosestIndex;
+}
+
+int32 UMinionBatchProcessor::FindClosestVisibleEnemy(int32 MinionRow, int32 NearestIndex, const USpatialHashSubsystem* SpatialHash, ULineOfSightSubsystem* LineOfSight)
+{
+	const AActor* Self = RegisteredMinions[MinionRow];
+
+	// Usually the nearest enemy is visible and its result is cached
+	if (LineOfSight->QueryLineOfSight(Self, TargetTable.Actors[NearestIndex]) == ELineOfSightResult::Visible)
+		return NearestIndex;
+
+	const FVector3f MinionLocation(MinionTable.PositionX[MinionRow], MinionTable.PositionY[MinionRow], MinionTable.PositionZ[MinionRow]);
+	const float DetectionRangeSquared = FMath::Square(MinionTable.DetectionRange[MinionRow]);
+
+	TSoAPositions<64> Candidates;
+	TArray<int32, TInlineAllocator<64>> CandidateEntries;
+	GatherEnemyCandidates(MinionRow, SpatialHash, Candidates, CandidateEntries);
+
+	TArray<float, TInlineAllocator<64>> DistSquared;
+	DistSquared.SetNumUninitialized(Candidates.Num());
+	Candidates.ComputeDistSquared(MinionLocation, DistSquared.GetData());
+
+	int32 Order[MaxLineOfSightCandidates];
+	const int32 NumOrdered = DistanceKernels::SelectKNearest(DistSquared.GetData(), DistSquared.Num(), MaxLineOfSightCandidates, Order);
+
+	// Nearest first; blocked and pending pairs are skipped (their traces are queued for the next search)
+	for (int32 i = 0; i < NumOrdered; i++)
+	{
+		const int32 Candidate = Order[i];
+		if (DistSquared[Candidate] >= DetectionRangeSquared)
+			break;
+
+		const int32 EntryIndex = CandidateEntries[Candidate];
+		if (EntryIndex == NearestIndex)
+			continue;
+
+		if (LineOfSight->QueryLineOfSight(Self, TargetTable.Actors[EntryIndex]) == ELineOfSightResult::Visible)
+			return EntryIndex;
+	}
+
+	return INDEX_NONE;
+}
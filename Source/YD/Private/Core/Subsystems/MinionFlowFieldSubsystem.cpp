@@ -0,0 +1,394 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/MinionFlowFieldSubsystem.h"
+#include "Blueprint/AIBlueprintHelperLibrary.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+
+void UMinionFlowFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FieldCellSize = 100.f;
+	FieldHalfExtentCells = 24; // 49x49 cells, ~2400 units around the goal
+	MinFollowersForField = 3;
+	FieldRebuildInterval = 0.25f;
+	WalkableLayerHeight = 200.f;
+	MaxWalkableProbesPerTick = 512; // A full 49x49 window is known after 5 ticks, a goal moving one cell needs 49
+	NavPathRequests = 0;
+	FieldBuilds = 0;
+	WalkableProbeBudget = 0;
+
+	UE_LOG(LogTemp, Log, TEXT("MinionFlowFieldSubsystem: Initialized (CellSize: %.1f)"), FieldCellSize);
+}
+
+void UMinionFlowFieldSubsystem::Deinitialize()
+{
+	Fields.Empty();
+	FollowerGoals.Empty();
+	WalkableCache.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMinionFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	const float Now = World->GetTimeSeconds();
+	WalkableProbeBudget = MaxWalkableProbesPerTick;
+
+	for (auto It = Fields.CreateIterator(); It; ++It)
+	{
+		FMinionFlowField& Field = It.Value();
+		AActor* Goal = Field.Goal.Get();
+
+		// Goal gone - stop everyone chasing it
+		if (!IsValid(Goal))
+		{
+			for (const FFlowFieldFollower& Follower : Field.Followers)
+			{
+				if (AController* Controller = Follower.Controller.Get())
+				{
+					FollowerGoals.Remove(Controller);
+					Controller->StopMovement();
+				}
+			}
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Field.Followers.RemoveAllSwap([](const FFlowFieldFollower& Follower)
+		{
+			return !Follower.Controller.IsValid() || !Follower.Controller->GetPawn();
+		});
+
+		if (Field.Followers.Num() == 0)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Switch between one shared field and individual paths as the group grows or shrinks
+		const bool bShouldUseField = Field.Followers.Num() >= MinFollowersForField;
+		if (bShouldUseField != Field.bFieldActive)
+		{
+			Field.bFieldActive = bShouldUseField;
+
+			for (FFlowFieldFollower& Follower : Field.Followers)
+			{
+				if (bShouldUseField)
+				{
+					// Existing paths are cancelled the first time the field covers the follower
+					Follower.bOnNavPath = true;
+				}
+				else if (!Follower.bOnNavPath)
+				{
+					RequestNavPath(Follower.Controller.Get(), Goal);
+					Follower.bOnNavPath = true;
+				}
+			}
+		}
+
+		if (!Field.bFieldActive)
+			continue;
+
+		const FVector GoalLocation = Goal->GetActorLocation();
+
+		// Rebuild when the goal changes cell, at most every FieldRebuildInterval
+		// Until the first build finishes, followers keep their navmesh paths (SampleField returns zero)
+		const bool bNeverBuilt = Field.Cost.Num() == 0;
+		const bool bGoalMoved = GetCell(GoalLocation) != Field.GoalCell;
+		if (bNeverBuilt || (bGoalMoved && Now - Field.LastBuildTime >= FieldRebuildInterval))
+		{
+			if (BuildField(Field, GoalLocation))
+			{
+				Field.LastBuildTime = Now;
+			}
+		}
+
+		for (FFlowFieldFollower& Follower : Field.Followers)
+		{
+			AController* Controller = Follower.Controller.Get();
+			APawn* Pawn = Controller->GetPawn();
+
+			const FVector Direction = SampleField(Field, Pawn->GetActorLocation(), GoalLocation);
+			if (!Direction.IsZero())
+			{
+				if (Follower.bOnNavPath)
+				{
+					Controller->StopMovement();
+					Follower.bOnNavPath = false;
+				}
+				Pawn->AddMovementInput(Direction);
+			}
+			else if (!Follower.bOnNavPath)
+			{
+				// Outside the window or on an unreachable cell
+				RequestNavPath(Controller, Goal);
+				Follower.bOnNavPath = true;
+			}
+		}
+	}
+}
+
+void UMinionFlowFieldSubsystem::MoveToActor(AController* Controller, AActor* Goal)
+{
+	if (!Controller || !Goal)
+		return;
+
+	if (const TObjectKey<AActor>* CurrentGoal = FollowerGoals.Find(Controller))
+	{
+		if (*CurrentGoal == TObjectKey<AActor>(Goal))
+		{
+			// Same goal - a lone follower re-paths like before, field followers need nothing
+			FMinionFlowField* Field = Fields.Find(Goal);
+			if (Field && !Field->bFieldActive)
+			{
+				RequestNavPath(Controller, Goal);
+			}
+			return;
+		}
+
+		RemoveFollower(Controller);
+	}
+
+	FMinionFlowField& Field = Fields.FindOrAdd(Goal);
+	Field.Goal = Goal;
+
+	FFlowFieldFollower& Follower = Field.Followers.AddDefaulted_GetRef();
+	Follower.Controller = Controller;
+	FollowerGoals.Add(Controller, Goal);
+
+	if (Field.bFieldActive)
+	{
+		// Drop any path to a previous goal, the field takes over next tick
+		Controller->StopMovement();
+		Follower.bOnNavPath = false;
+	}
+	else
+	{
+		RequestNavPath(Controller, Goal);
+		Follower.bOnNavPath = true;
+	}
+}
+
+void UMinionFlowFieldSubsystem::StopMovement(AController* Controller)
+{
+	if (!Controller)
+		return;
+
+	RemoveFollower(Controller);
+	Controller->StopMovement();
+}
+
+void UMinionFlowFieldSubsystem::RemoveFollower(AController* Controller)
+{
+	TObjectKey<AActor> Goal;
+	if (!FollowerGoals.RemoveAndCopyValue(Controller, Goal))
+		return;
+
+	FMinionFlowField* Field = Fields.Find(Goal);
+	if (!Field)
+		return;
+
+	Field->Followers.RemoveAllSwap([Controller](const FFlowFieldFollower& Follower)
+	{
+		return Follower.Controller.Get() == Controller;
+	});
+
+	if (Field->Followers.Num() == 0)
+	{
+		Fields.Remove(Goal);
+	}
+}
+
+void UMinionFlowFieldSubsystem::RequestNavPath(AController* Controller, AActor* Goal)
+{
+	if (!Controller || !Goal)
+		return;
+
+	NavPathRequests++;
+	UAIBlueprintHelperLibrary::SimpleMoveToActor(Controller, Goal);
+}
+
+FIntPoint UMinionFlowFieldSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / FieldCellSize),
+		FMath::FloorToInt(Location.Y / FieldCellSize)
+	);
+}
+
+FVector UMinionFlowFieldSubsystem::GetCellCenter(const FIntPoint& Cell, float Z) const
+{
+	return FVector((Cell.X + 0.5f) * FieldCellSize, (Cell.Y + 0.5f) * FieldCellSize, Z);
+}
+
+bool UMinionFlowFieldSubsystem::TryGetCellWalkable(const FIntPoint& Cell, float Z, bool& bOutWalkable)
+{
+	const float LayerHeight = FMath::Max(1.f, WalkableLayerHeight);
+	const int32 Layer = FMath::FloorToInt(Z / LayerHeight);
+
+	const FIntVector Key(Cell.X, Cell.Y, Layer);
+	if (const bool* bCached = WalkableCache.Find(Key))
+	{
+		bOutWalkable = *bCached;
+		return true;
+	}
+
+	// No navigation system - treat everything as open
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+	{
+		bOutWalkable = true;
+		return true;
+	}
+
+	if (WalkableProbeBudget <= 0)
+		return false;
+
+	WalkableProbeBudget--;
+
+	// Probe from the layer center so the cached result holds for any Z in the layer
+	FNavLocation Projected;
+	const FVector Extent(FieldCellSize * 0.5f, FieldCellSize * 0.5f, LayerHeight);
+	bOutWalkable = NavSys->ProjectPointToNavigation(GetCellCenter(Cell, (Layer + 0.5f) * LayerHeight), Projected, Extent);
+
+	WalkableCache.Add(Key, bOutWalkable);
+	return true;
+}
+
+bool UMinionFlowFieldSubsystem::BuildField(FMinionFlowField& Field, const FVector& GoalLocation)
+{
+	const int32 HalfExtent = FMath::Max(1, FieldHalfExtentCells);
+	const FIntPoint GoalCell = GetCell(GoalLocation);
+	const FIntPoint Origin = GoalCell - FIntPoint(HalfExtent, HalfExtent);
+	const int32 Width = HalfExtent * 2 + 1;
+	const int32 NumCells = Width * Width;
+
+	// Cells past this tick's probe budget stay unknown until a later tick
+	TArray<uint8> Walkable;
+	Walkable.SetNumUninitialized(NumCells);
+	bool bAllKnown = true;
+	for (int32 Y = 0; Y < Width; Y++)
+	{
+		for (int32 X = 0; X < Width; X++)
+		{
+			bool bWalkable = false;
+			if (!TryGetCellWalkable(Origin + FIntPoint(X, Y), GoalLocation.Z, bWalkable))
+			{
+				bAllKnown = false;
+			}
+			Walkable[Y * Width + X] = bWalkable ? 1 : 0;
+		}
+	}
+
+	// Window not fully probed yet - keep the previous field and finish on a later tick
+	if (!bAllKnown)
+		return false;
+
+	FieldBuilds++;
+
+	Field.GoalCell = GoalCell;
+	Field.Origin = Origin;
+	Field.Width = Width;
+	Field.Cost.Init(MAX_uint16, NumCells);
+
+	// Dijkstra from the goal, 10 per straight step and 14 per diagonal
+	static const int32 OffsetX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+	static const int32 OffsetY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+	static const uint16 StepCost[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+
+	auto HeapLess = [](const TPair<uint16, int32>& A, const TPair<uint16, int32>& B)
+	{
+		return A.Key < B.Key;
+	};
+
+	TArray<TPair<uint16, int32>> Open;
+	const int32 GoalIndex = HalfExtent * Field.Width + HalfExtent;
+	Walkable[GoalIndex] = 1; // The goal itself may stand off-mesh
+	Field.Cost[GoalIndex] = 0;
+	Open.HeapPush(TPair<uint16, int32>(0, GoalIndex), HeapLess);
+
+	while (Open.Num() > 0)
+	{
+		TPair<uint16, int32> Current;
+		Open.HeapPop(Current, HeapLess, EAllowShrinking::No);
+
+		if (Current.Key > Field.Cost[Current.Value])
+			continue; // Stale entry
+
+		const int32 CellX = Current.Value % Field.Width;
+		const int32 CellY = Current.Value / Field.Width;
+
+		for (int32 Dir = 0; Dir < 8; Dir++)
+		{
+			const int32 NextX = CellX + OffsetX[Dir];
+			const int32 NextY = CellY + OffsetY[Dir];
+			if (NextX < 0 || NextY < 0 || NextX >= Field.Width || NextY >= Field.Width)
+				continue;
+
+			const int32 NextIndex = NextY * Field.Width + NextX;
+			if (!Walkable[NextIndex])
+				continue;
+
+			// No cutting corners past walls
+			if (Dir >= 4 && (!Walkable[CellY * Field.Width + NextX] || !Walkable[NextY * Field.Width + CellX]))
+				continue;
+
+			const uint16 NewCost = Current.Key + StepCost[Dir];
+			if (NewCost < Field.Cost[NextIndex])
+			{
+				Field.Cost[NextIndex] = NewCost;
+				Open.HeapPush(TPair<uint16, int32>(NewCost, NextIndex), HeapLess);
+			}
+		}
+	}
+	return true;
+}
+
+FVector UMinionFlowFieldSubsystem::SampleField(const FMinionFlowField& Field, const FVector& Location, const FVector& GoalLocation) const
+{
+	const FIntPoint Local = GetCell(Location) - Field.Origin;
+	if (Local.X < 0 || Local.Y < 0 || Local.X >= Field.Width || Local.Y >= Field.Width)
+		return FVector::ZeroVector;
+
+	const int32 Index = Local.Y * Field.Width + Local.X;
+	if (Field.Cost[Index] == MAX_uint16)
+		return FVector::ZeroVector;
+
+	// Next to the goal - head straight for it
+	const FIntPoint ToGoal = Field.GoalCell - (Field.Origin + Local);
+	if (FMath::Abs(ToGoal.X) <= 1 && FMath::Abs(ToGoal.Y) <= 1)
+		return (GoalLocation - Location).GetSafeNormal2D();
+
+	// Step towards the cheapest neighbour
+	int32 BestIndex = Index;
+	FIntPoint BestLocal = Local;
+	for (int32 OffsetY = -1; OffsetY <= 1; OffsetY++)
+	{
+		for (int32 OffsetX = -1; OffsetX <= 1; OffsetX++)
+		{
+			const FIntPoint Next = Local + FIntPoint(OffsetX, OffsetY);
+			if (Next.X < 0 || Next.Y < 0 || Next.X >= Field.Width || Next.Y >= Field.Width)
+				continue;
+
+			const int32 NextIndex = Next.Y * Field.Width + Next.X;
+			if (Field.Cost[NextIndex] < Field.Cost[BestIndex])
+			{
+				BestIndex = NextIndex;
+				BestLocal = Next;
+			}
+		}
+	}
+
+	if (BestIndex == Index)
+		return FVector::ZeroVector;
+
+	return (GetCellCenter(Field.Origin + BestLocal, Location.Z) - Location).GetSafeNormal2D();
+}
@@ -1,68 +1,143 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Core/Subsystems/MinionPoolManager.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
 #include "Gameplay/Characters/Enemy/Enemy_Base.h"
 #include "Gameplay/Components/CharacterStatComponent.h"
 #include "Gameplay/Components/CombatComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 
-void UMinionPoolManager::InitializePool(TSubclassOf<AEnemy_Base> MinionClass, int32 InitialPoolSize)
+void UMinionPoolManager::Initialize(FSubsystemCollectionBase& Collection)
 {
-	if (!MinionClass)
-	{
-		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: MinionClass is null! Cannot initialize pool."));
-		return;
-	}
+	Super::Initialize(Collection);
 
-	// Validate that MinionClass is actually a valid Actor class
-	if (!MinionClass->IsChildOf(AActor::StaticClass()))
-	{
-		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: MinionClass is not an Actor! Class: %s"),
-			*MinionClass->GetName());
-		return;
-	}
+	SpawnsPerFrame = 4;
+	PendingWarmupCount = 0;
+	PoolHits = 0;
+	PoolMisses = 0;
+}
+
+void UMinionPoolManager::Deinitialize()
+{
+	SubPools.Empty();
+	DefaultMinionClass = nullptr;
+	PendingWarmupCount = 0;
 
-	MinionClassToSpawn = MinionClass;
+	Super::Deinitialize();
+}
 
-	UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Initializing pool with class: %s, count: %d"),
-		*MinionClass->GetName(), InitialPoolSize);
+void UMinionPoolManager::Tick(float DeltaTime)
+{
+	// Spread warm-up spawns over frames so map load isn't stalled
+	int32 SpawnBudget = FMath::Max(1, SpawnsPerFrame);
 
-	// Pre-spawn minions for the pool
-	for (int32 i = 0; i < InitialPoolSize; i++)
+	for (auto& Pair : SubPools)
 	{
-		AEnemy_Base* Minion = SpawnNewMinion();
-		if (Minion)
+		FMinionSubPool& SubPool = Pair.Value;
+
+		while (SpawnBudget > 0 && SubPool.PendingWarmup > 0)
 		{
+			SpawnBudget--;
+
+			AEnemy_Base* Minion = SpawnNewMinion(SubPool.MinionClass);
+			if (!Minion)
+			{
+				// Class is broken - drop the rest of its warm-up instead of retrying every frame
+				PendingWarmupCount -= SubPool.PendingWarmup - 1;
+				SubPool.PendingWarmup = 1;
+				ConsumeWarmup(SubPool);
+				break;
+			}
+
 			DeactivateMinion(Minion);
-			InactiveMinions.Add(Minion);
-			UE_LOG(LogTemp, Log, TEXT("  Pooled minion %d: %s"), i, *Minion->GetName());
+			SubPool.InactiveMinions.Add(Minion);
+			ConsumeWarmup(SubPool);
 		}
-		else
+
+		if (SubPool.Config.TrimPolicy == EMinionPoolTrimPolicy::TrimToHighWaterMark)
 		{
-			UE_LOG(LogTemp, Error, TEXT("  Failed to spawn minion %d!"), i);
+			SubPool.TrimTimer += DeltaTime;
+			if (SubPool.TrimTimer >= SubPool.Config.TrimInterval)
+			{
+				SubPool.TrimTimer = 0.f;
+				TrimSubPool(SubPool);
+			}
 		}
 	}
+}
+
+void UMinionPoolManager::InitializePool(TSubclassOf<AEnemy_Base> MinionClass, int32 InitialPoolSize)
+{
+	FMinionPoolConfig Config;
+	if (const FMinionSubPool* Existing = SubPools.Find(MinionClass))
+	{
+		Config = Existing->Config;
+	}
+	Config.InitialSize = InitialPoolSize;
+
+	InitializePoolWithConfig(MinionClass, Config);
+}
+
+void UMinionPoolManager::InitializePoolWithConfig(TSubclassOf<AEnemy_Base> MinionClass, const FMinionPoolConfig& Config)
+{
+	FMinionSubPool* SubPool = FindOrAddSubPool(MinionClass);
+	if (!SubPool)
+		return;
+
+	SubPool->Config = Config;
+
+	// Minions already handed out or pooled count towards the target size
+	const int32 Existing = SubPool->ActiveMinions.Num() + SubPool->InactiveMinions.Num();
+	const int32 NewPending = FMath::Max(0, Config.InitialSize - Existing);
+	PendingWarmupCount += NewPending - SubPool->PendingWarmup;
+	SubPool->PendingWarmup = NewPending;
+
+	UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Warming up pool with class: %s, count: %d (%d per frame)"),
+		*MinionClass->GetName(), NewPending, SpawnsPerFrame);
 
-	UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Initialized pool with %d minions"), InactiveMinions.Num());
+	if (PendingWarmupCount == 0)
+	{
+		OnPoolWarmupComplete.Broadcast(GetActiveCount() + GetInactiveCount());
+	}
 }
 
 AEnemy_Base* UMinionPoolManager::GetMinion(const FVector& SpawnLocation, const FRotator& SpawnRotation)
 {
+	if (!DefaultMinionClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: No minion class set!"));
+		return nullptr;
+	}
+
+	return GetMinionOfClass(DefaultMinionClass, SpawnLocation, SpawnRotation);
+}
+
+AEnemy_Base* UMinionPoolManager::GetMinionOfClass(TSubclassOf<AEnemy_Base> MinionClass, const FVector& SpawnLocation, const FRotator& SpawnRotation)
+{
+	FMinionSubPool* SubPool = FindOrAddSubPool(MinionClass);
+	if (!SubPool)
+		return nullptr;
+
 	AEnemy_Base* Minion = nullptr;
+	bool bSpawnedOnDemand = false;
 
 	// Try to reuse from pool
-	if (InactiveMinions.Num() > 0)
+	if (SubPool->InactiveMinions.Num() > 0)
 	{
-		Minion = InactiveMinions.Pop();
+		Minion = SubPool->InactiveMinions.Pop();
 		ActivateMinion(Minion, SpawnLocation, SpawnRotation);
+		PoolHits++;
 	}
 	else
 	{
+		PoolMisses++;
+
 		// Pool is empty, spawn new minion
-		Minion = SpawnNewMinion();
+		Minion = SpawnNewMinion(MinionClass);
 		if (Minion)
 		{
+			bSpawnedOnDemand = true;
 			Minion->SetActorLocation(SpawnLocation);
 			Minion->SetActorRotation(SpawnRotation);
 		}
@@ -70,7 +145,15 @@ AEnemy_Base* UMinionPoolManager::GetMinion(const FVector& SpawnLocation, const F
 
 	if (Minion)
 	{
-		ActiveMinions.Add(Minion);
+		SubPool->ActiveIndex.Add(Minion);
+		SubPool->ActiveMinions.Add(Minion);
+		SubPool->HighWaterMark = FMath::Max(SubPool->HighWaterMark, SubPool->ActiveMinions.Num());
+
+		// Spawned on demand during warm-up - one less for warm-up to create
+		if (bSpawnedOnDemand)
+		{
+			ConsumeWarmup(*SubPool);
+		}
 	}
 
 	return Minion;
@@ -81,30 +164,168 @@ void UMinionPoolManager::ReturnMinion(AEnemy_Base* Minion)
 	if (!Minion)
 		return;
 
-	// Remove from active list
-	ActiveMinions.Remove(Minion);
+	FMinionSubPool* SubPool = SubPools.Find(Minion->GetClass());
+	if (!SubPool)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MinionPoolManager: %s has no pool for its class, destroying it"), *Minion->GetName());
+		Minion->Destroy();
+		return;
+	}
+
+	// Remove from active list - a minion that isn't active (already returned) must not enter the pool twice
+	const int32 ActiveSlot = SubPool->ActiveIndex.Remove(Minion);
+	if (ActiveSlot == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MinionPoolManager: %s is not an active pooled minion, ignoring ReturnMinion"), *Minion->GetName());
+		return;
+	}
+	SubPool->ActiveMinions.RemoveAtSwap(ActiveSlot, 1, EAllowShrinking::No);
+
+	const int32 Capacity = SubPool->Config.Capacity;
+	if (SubPool->Config.TrimPolicy == EMinionPoolTrimPolicy::DestroyOverCapacity && Capacity > 0 && SubPool->InactiveMinions.Num() >= Capacity)
+	{
+		Minion->Destroy();
+		return;
+	}
 
 	// Deactivate and add to inactive pool
 	DeactivateMinion(Minion);
-	InactiveMinions.Add(Minion);
+	SubPool->InactiveMinions.Add(Minion);
+
+	UE_LOG(LogTemp, Verbose, TEXT("MinionPoolManager: Returned %s to pool. Active: %d, Inactive: %d"),
+		*Minion->GetClass()->GetName(), SubPool->ActiveMinions.Num(), SubPool->InactiveMinions.Num());
+}
 
-	UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Returned minion to pool. Active: %d, Inactive: %d"),
-		ActiveMinions.Num(), InactiveMinions.Num());
+bool UMinionPoolManager::IsActivePooledMinion(const AEnemy_Base* Minion) const
+{
+	if (!Minion)
+		return false;
+
+	const FMinionSubPool* SubPool = SubPools.Find(Minion->GetClass());
+	return SubPool && SubPool->ActiveIndex.Contains(Minion);
 }
 
-AEnemy_Base* UMinionPoolManager::SpawnNewMinion()
+float UMinionPoolManager::GetPoolHitRate() const
 {
-	if (!MinionClassToSpawn)
+	const int32 Total = PoolHits + PoolMisses;
+	return Total > 0 ? static_cast<float>(PoolHits) / Total : 0.f;
+}
+
+int32 UMinionPoolManager::GetActiveCount() const
+{
+	int32 Count = 0;
+	for (const auto& Pair : SubPools)
 	{
-		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: No minion class set!"));
+		Count += Pair.Value.ActiveMinions.Num();
+	}
+	return Count;
+}
+
+int32 UMinionPoolManager::GetInactiveCount() const
+{
+	int32 Count = 0;
+	for (const auto& Pair : SubPools)
+	{
+		Count += Pair.Value.InactiveMinions.Num();
+	}
+	return Count;
+}
+
+int32 UMinionPoolManager::GetActiveCountOfClass(TSubclassOf<AEnemy_Base> MinionClass) const
+{
+	const FMinionSubPool* SubPool = SubPools.Find(MinionClass);
+	return SubPool ? SubPool->ActiveMinions.Num() : 0;
+}
+
+int32 UMinionPoolManager::GetInactiveCountOfClass(TSubclassOf<AEnemy_Base> MinionClass) const
+{
+	const FMinionSubPool* SubPool = SubPools.Find(MinionClass);
+	return SubPool ? SubPool->InactiveMinions.Num() : 0;
+}
+
+int32 UMinionPoolManager::GetHighWaterMarkOfClass(TSubclassOf<AEnemy_Base> MinionClass) const
+{
+	const FMinionSubPool* SubPool = SubPools.Find(MinionClass);
+	return SubPool ? SubPool->HighWaterMark : 0;
+}
+
+FMinionSubPool* UMinionPoolManager::FindOrAddSubPool(TSubclassOf<AEnemy_Base> MinionClass)
+{
+	if (!MinionClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: MinionClass is null! Cannot initialize pool."));
 		return nullptr;
 	}
 
-	// Additional validation
-	if (!MinionClassToSpawn->IsChildOf(AEnemy_Base::StaticClass()))
+	if (FMinionSubPool* Existing = SubPools.Find(MinionClass))
+		return Existing;
+
+	// Validate that MinionClass is actually a valid Enemy_Base class
+	if (!MinionClass->IsChildOf(AEnemy_Base::StaticClass()))
 	{
-		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: MinionClassToSpawn is not a valid Enemy_Base class! Class: %s"),
-			*MinionClassToSpawn->GetName());
+		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: MinionClass is not a valid Enemy_Base class! Class: %s"),
+			*MinionClass->GetName());
+		return nullptr;
+	}
+
+	FMinionSubPool& SubPool = SubPools.Add(MinionClass);
+	SubPool.MinionClass = MinionClass;
+
+	// The first pooled class keeps serving the class-less GetMinion
+	if (!DefaultMinionClass)
+	{
+		DefaultMinionClass = MinionClass;
+	}
+
+	return &SubPool;
+}
+
+void UMinionPoolManager::ConsumeWarmup(FMinionSubPool& SubPool)
+{
+	if (SubPool.PendingWarmup <= 0)
+		return;
+
+	SubPool.PendingWarmup--;
+	PendingWarmupCount--;
+
+	if (PendingWarmupCount == 0)
+	{
+		const int32 Active = GetActiveCount();
+		const int32 Inactive = GetInactiveCount();
+		UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Warm-up complete. Active: %d, Inactive: %d"), Active, Inactive);
+		OnPoolWarmupComplete.Broadcast(Active + Inactive);
+	}
+}
+
+void UMinionPoolManager::TrimSubPool(FMinionSubPool& SubPool)
+{
+	// Keep enough idle minions to cover the recent peak, and at least Capacity
+	const int32 KeepIdle = FMath::Max(SubPool.HighWaterMark - SubPool.ActiveMinions.Num(), SubPool.Config.Capacity);
+	const int32 NumToDestroy = SubPool.InactiveMinions.Num() - KeepIdle;
+
+	for (int32 i = 0; i < NumToDestroy; i++)
+	{
+		if (AEnemy_Base* Minion = SubPool.InactiveMinions.Pop(EAllowShrinking::No))
+		{
+			Minion->Destroy();
+		}
+	}
+
+	if (NumToDestroy > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Trimmed %d idle %s. Inactive: %d"),
+			NumToDestroy, *SubPool.MinionClass->GetName(), SubPool.InactiveMinions.Num());
+	}
+
+	// Start a new measuring window
+	SubPool.HighWaterMark = SubPool.ActiveMinions.Num();
+}
+
+AEnemy_Base* UMinionPoolManager::SpawnNewMinion(TSubclassOf<AEnemy_Base> MinionClass)
+{
+	if (!MinionClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("MinionPoolManager: No minion class set!"));
 		return nullptr;
 	}
 
@@ -118,11 +339,11 @@ AEnemy_Base* UMinionPoolManager::SpawnNewMinion()
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Attempting to spawn minion of class: %s"),
-		*MinionClassToSpawn->GetName());
+	UE_LOG(LogTemp, Verbose, TEXT("MinionPoolManager: Attempting to spawn minion of class: %s"),
+		*MinionClass->GetName());
 
 	AEnemy_Base* Minion = World->SpawnActor<AEnemy_Base>(
-		MinionClassToSpawn,
+		MinionClass,
 		FVector::ZeroVector,
 		FRotator::ZeroRotator,
 		SpawnParams
@@ -139,7 +360,7 @@ AEnemy_Base* UMinionPoolManager::SpawnNewMinion()
 			Minion->SpawnDefaultController();
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("MinionPoolManager: Successfully spawned minion %s with controller: %s"),
+		UE_LOG(LogTemp, Verbose, TEXT("MinionPoolManager: Successfully spawned minion %s with controller: %s"),
 			*Minion->GetName(),
 			Minion->GetController() ? TEXT("YES") : TEXT("NO"));
 	}
@@ -177,6 +398,12 @@ void UMinionPoolManager::DeactivateMinion(AEnemy_Base* Minion)
 
 	// Clear movement target
 	Minion->SetMovementTarget(nullptr);
+
+	// Pooled minions must not show up in proximity queries
+	if (USpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<USpatialHashSubsystem>())
+	{
+		SpatialHash->UnregisterActor(Minion);
+	}
 }
 
 void UMinionPoolManager::ActivateMinion(AEnemy_Base* Minion, const FVector& Location, const FRotator& Rotation)
@@ -228,6 +455,12 @@ void UMinionPoolManager::ActivateMinion(AEnemy_Base* Minion, const FVector& Loca
 		Movement->Activate();
 	}
 
+	// Back into proximity queries at the new location
+	if (USpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<USpatialHashSubsystem>())
+	{
+		SpatialHash->RegisterActor(Minion);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("MinionPool: Activated minion at location: %s, Controller: %s"),
 		*Location.ToString(), Minion->GetController() ? TEXT("YES") : TEXT("NO"));
 }
@@ -0,0 +1,405 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/SpatialHashSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+void USpatialHashSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DefaultCellSize = 800.f;
+	CellSize = DefaultCellSize;
+	LargestQueryRadius = 0.f;
+
+	UE_LOG(LogTemp, Log, TEXT("SpatialHashSubsystem: Initialized (CellSize: %.1f)"), CellSize);
+}
+
+void USpatialHashSubsystem::Deinitialize()
+{
+	EntryActors.Empty();
+	EntryLocations.Empty();
+	EntryCells.Empty();
+	ActorToEntry.Empty();
+	Cells.Empty();
+	RangeTriggers.Empty();
+	TriggersByActor.Empty();
+	DirtyTriggers.Empty();
+
+	Super::Deinitialize();
+}
+
+void USpatialHashSubsystem::Tick(float DeltaTime)
+{
+	// Iterate backwards so swap-removal of dead entries doesn't skip anything
+	for (int32 i = EntryActors.Num() - 1; i >= 0; --i)
+	{
+		AActor* Actor = EntryActors[i];
+		if (!IsValid(Actor))
+		{
+			RemoveEntryAt(i);
+			continue;
+		}
+
+		RefreshEntry(i, Actor->GetActorLocation());
+	}
+
+	if (RangeTriggers.Num() > 0)
+	{
+		EvaluateRangeTriggers();
+	}
+}
+
+void USpatialHashSubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor || ActorToEntry.Contains(Actor))
+		return;
+
+	const FVector Location = Actor->GetActorLocation();
+	const FIntPoint Cell = GetCellKey(Location);
+
+	const int32 EntryIndex = EntryActors.Add(Actor);
+	EntryLocations.Add(Location);
+	EntryCells.Add(Cell);
+	ActorToEntry.Add(Actor, EntryIndex);
+
+	AddToCell(EntryIndex, Cell);
+}
+
+void USpatialHashSubsystem::UnregisterActor(AActor* Actor)
+{
+	if (!Actor)
+		return;
+
+	const int32* EntryIndex = ActorToEntry.Find(Actor);
+	if (!EntryIndex)
+		return;
+
+	RemoveEntryAt(*EntryIndex);
+
+	// The actor may live on (pooled) but is no longer a valid endpoint - its movement can't be observed either
+	if (TriggersByActor.Contains(Actor))
+	{
+		CancelTriggersFor(Actor);
+	}
+}
+
+void USpatialHashSubsystem::UpdateActor(AActor* Actor)
+{
+	if (!Actor)
+		return;
+
+	const int32* EntryIndex = ActorToEntry.Find(Actor);
+	if (!EntryIndex)
+		return;
+
+	RefreshEntry(*EntryIndex, Actor->GetActorLocation());
+}
+
+void USpatialHashSubsystem::SetCellSize(float NewCellSize)
+{
+	if (NewCellSize <= 0.f || FMath::IsNearlyEqual(NewCellSize, CellSize))
+		return;
+
+	CellSize = NewCellSize;
+
+	// Rebuild all buckets with the new cell size
+	Cells.Reset();
+	for (int32 i = 0; i < EntryActors.Num(); i++)
+	{
+		EntryCells[i] = GetCellKey(EntryLocations[i]);
+		AddToCell(i, EntryCells[i]);
+	}
+}
+
+void USpatialHashSubsystem::ReserveQueryRadius(float Radius)
+{
+	if (Radius <= LargestQueryRadius)
+		return;
+
+	LargestQueryRadius = Radius;
+	SetCellSize(Radius);
+
+	UE_LOG(LogTemp, Log, TEXT("SpatialHashSubsystem: CellSize set to %.1f from query radius"), CellSize);
+}
+
+void USpatialHashSubsystem::QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, const AActor* IgnoreActor) const
+{
+	ForEachEntryInRadius(Center, Radius, [this, &OutActors, IgnoreActor](int32 EntryIndex, float DistSquared)
+	{
+		AActor* Actor = EntryActors[EntryIndex];
+		if (Actor && Actor != IgnoreActor)
+		{
+			OutActors.Add(Actor);
+		}
+	});
+}
+
+void USpatialHashSubsystem::QueryKNearest(const FVector& Center, int32 K, float MaxRadius, TArray<AActor*>& OutActors, const AActor* IgnoreActor) const
+{
+	if (K <= 0)
+		return;
+
+	TArray<TPair<float, int32>, TInlineAllocator<64>> Candidates;
+	ForEachEntryInRadius(Center, MaxRadius, [this, &Candidates, IgnoreActor](int32 EntryIndex, float DistSquared)
+	{
+		AActor* Actor = EntryActors[EntryIndex];
+		if (Actor && Actor != IgnoreActor)
+		{
+			Candidates.Emplace(DistSquared, EntryIndex);
+		}
+	});
+
+	// Nearest first, entry index breaks ties so results are stable
+	Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
+	});
+
+	const int32 NumResults = FMath::Min(K, Candidates.Num());
+	for (int32 i = 0; i < NumResults; i++)
+	{
+		OutActors.Add(EntryActors[Candidates[i].Value]);
+	}
+}
+
+int32 USpatialHashSubsystem::AddRangeTrigger(const AActor* Source, const AActor* Target, float Radius, FSimpleDelegate OnEnter, FSimpleDelegate OnCancel)
+{
+	if (!Source || !Target)
+		return INDEX_NONE;
+
+	const int32 Handle = NextTriggerHandle++;
+
+	FRangeTrigger& Trigger = RangeTriggers.Add(Handle);
+	Trigger.Source = Source;
+	Trigger.Target = Target;
+	Trigger.RadiusSquared = FMath::Square(FMath::Max(Radius, 0.f));
+	Trigger.OnEnter = MoveTemp(OnEnter);
+	Trigger.OnCancel = MoveTemp(OnCancel);
+	Trigger.bPollEveryTick = !IsRegistered(Source) || !IsRegistered(Target);
+
+	TriggersByActor.FindOrAdd(Source).Add(Handle);
+	TriggersByActor.FindOrAdd(Target).Add(Handle);
+
+	// Checked on the next tick even if nothing moves
+	DirtyTriggers.Add(Handle);
+
+	return Handle;
+}
+
+void USpatialHashSubsystem::RemoveRangeTrigger(int32 Handle)
+{
+	FRangeTrigger Trigger;
+	if (!RangeTriggers.RemoveAndCopyValue(Handle, Trigger))
+		return;
+
+	UnlinkTrigger(Handle, Trigger);
+}
+
+void USpatialHashSubsystem::UnlinkTrigger(int32 Handle, const FRangeTrigger& Trigger)
+{
+	for (const AActor* Endpoint : { Trigger.Source.Get(), Trigger.Target.Get() })
+	{
+		if (!Endpoint)
+			continue;
+
+		if (auto* Handles = TriggersByActor.Find(Endpoint))
+		{
+			Handles->RemoveSingleSwap(Handle, EAllowShrinking::No);
+			if (Handles->Num() == 0)
+			{
+				TriggersByActor.Remove(Endpoint);
+			}
+		}
+	}
+}
+
+void USpatialHashSubsystem::CancelTriggersFor(const AActor* Actor)
+{
+	TArray<int32, TInlineAllocator<2>> Handles;
+	if (!TriggersByActor.RemoveAndCopyValue(Actor, Handles))
+		return;
+
+	// Fire after unlinking - callbacks may add or remove triggers
+	TArray<FSimpleDelegate, TInlineAllocator<2>> Cancelled;
+	for (int32 Handle : Handles)
+	{
+		FRangeTrigger Trigger;
+		if (RangeTriggers.RemoveAndCopyValue(Handle, Trigger))
+		{
+			UnlinkTrigger(Handle, Trigger);
+			Cancelled.Add(MoveTemp(Trigger.OnCancel));
+		}
+	}
+
+	for (FSimpleDelegate& OnCancel : Cancelled)
+	{
+		OnCancel.ExecuteIfBound();
+	}
+}
+
+void USpatialHashSubsystem::MarkTriggersDirty(const AActor* Actor)
+{
+	if (const auto* Handles = TriggersByActor.Find(Actor))
+	{
+		DirtyTriggers.Append(*Handles);
+	}
+}
+
+void USpatialHashSubsystem::EvaluateRangeTriggers()
+{
+	for (const TPair<int32, FRangeTrigger>& Pair : RangeTriggers)
+	{
+		if (Pair.Value.bPollEveryTick)
+		{
+			DirtyTriggers.Add(Pair.Key);
+		}
+	}
+
+	if (DirtyTriggers.Num() == 0)
+		return;
+
+	// Fire after the pass - callbacks may add or remove triggers
+	TArray<FSimpleDelegate, TInlineAllocator<8>> Fired;
+	TArray<FSimpleDelegate, TInlineAllocator<8>> Cancelled;
+
+	for (int32 Handle : DirtyTriggers)
+	{
+		const FRangeTrigger* Trigger = RangeTriggers.Find(Handle);
+		if (!Trigger)
+			continue;
+
+		const AActor* Source = Trigger->Source.Get();
+		const AActor* Target = Trigger->Target.Get();
+
+		// An endpoint is gone - the trigger can never fire
+		if (!Source || !Target)
+		{
+			FRangeTrigger Removed;
+			RangeTriggers.RemoveAndCopyValue(Handle, Removed);
+			UnlinkTrigger(Handle, Removed);
+			Cancelled.Add(MoveTemp(Removed.OnCancel));
+			continue;
+		}
+
+		if (FVector::DistSquared(Source->GetActorLocation(), Target->GetActorLocation()) > Trigger->RadiusSquared)
+			continue;
+
+		FRangeTrigger Entered;
+		RangeTriggers.RemoveAndCopyValue(Handle, Entered);
+		UnlinkTrigger(Handle, Entered);
+		Fired.Add(MoveTemp(Entered.OnEnter));
+	}
+	DirtyTriggers.Reset();
+
+	for (FSimpleDelegate& OnCancel : Cancelled)
+	{
+		OnCancel.ExecuteIfBound();
+	}
+
+	for (FSimpleDelegate& OnEnter : Fired)
+	{
+		OnEnter.ExecuteIfBound();
+	}
+}
+
+int32 USpatialHashSubsystem::FindEntryIndex(const AActor* Actor) const
+{
+	const int32* EntryIndex = ActorToEntry.Find(Actor);
+	return EntryIndex ? *EntryIndex : INDEX_NONE;
+}
+
+FIntPoint USpatialHashSubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize)
+	);
+}
+
+void USpatialHashSubsystem::AddToCell(int32 EntryIndex, const FIntPoint& Cell)
+{
+	Cells.FindOrAdd(Cell).Add(EntryIndex);
+}
+
+void USpatialHashSubsystem::RemoveFromCell(int32 EntryIndex, const FIntPoint& Cell)
+{
+	TArray<int32>* CellEntries = Cells.Find(Cell);
+	if (!CellEntries)
+		return;
+
+	CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+	if (CellEntries->Num() == 0)
+	{
+		Cells.Remove(Cell);
+	}
+}
+
+void USpatialHashSubsystem::RemoveEntryAt(int32 EntryIndex)
+{
+	if (!EntryActors.IsValidIndex(EntryIndex))
+		return;
+
+	RemoveFromCell(EntryIndex, EntryCells[EntryIndex]);
+
+	// Actor may already be nulled by GC, so clean the lookup by index in that case
+	if (AActor* Actor = EntryActors[EntryIndex])
+	{
+		ActorToEntry.Remove(Actor);
+	}
+	else
+	{
+		for (auto It = ActorToEntry.CreateIterator(); It; ++It)
+		{
+			if (It.Value() == EntryIndex)
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
+
+	// Move the last entry into the freed slot
+	const int32 LastIndex = EntryActors.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		if (TArray<int32>* LastCellEntries = Cells.Find(EntryCells[LastIndex]))
+		{
+			const int32 Slot = LastCellEntries->Find(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*LastCellEntries)[Slot] = EntryIndex;
+			}
+		}
+
+		if (AActor* LastActor = EntryActors[LastIndex])
+		{
+			ActorToEntry.Add(LastActor, EntryIndex);
+		}
+	}
+
+	EntryActors.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	EntryLocations.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	EntryCells.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+}
+
+void USpatialHashSubsystem::RefreshEntry(int32 EntryIndex, const FVector& NewLocation)
+{
+	if (EntryLocations[EntryIndex] == NewLocation)
+		return;
+
+	EntryLocations[EntryIndex] = NewLocation;
+
+	if (TriggersByActor.Num() > 0)
+	{
+		MarkTriggersDirty(EntryActors[EntryIndex]);
+	}
+
+	const FIntPoint NewCell = GetCellKey(NewLocation);
+	if (NewCell != EntryCells[EntryIndex])
+	{
+		RemoveFromCell(EntryIndex, EntryCells[EntryIndex]);
+		AddToCell(EntryIndex, NewCell);
+		EntryCells[EntryIndex] = NewCell;
+	}
+}
@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Subsystems/TargetingQueryCacheSubsystem.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_STAT(STAT_TargetingQueryCacheHits);
+DEFINE_STAT(STAT_TargetingQueryCacheMisses);
+DEFINE_STAT(STAT_TargetingValidateMemoHits);
+
+void UTargetingQueryCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	QuantizeCellSize = 50.f;
+	bEnabled = true;
+	NumResultsUsed = 0;
+	CachedFrame = GFrameCounter;
+	CacheHits = 0;
+	CacheMisses = 0;
+}
+
+void UTargetingQueryCacheSubsystem::Deinitialize()
+{
+	ResultIndex.Empty();
+	Results.Empty();
+	NumResultsUsed = 0;
+
+	Super::Deinitialize();
+}
+
+bool UTargetingQueryCacheSubsystem::Find(const FTargetingQueryKey& Key, FTargetingResultArray& OutTargets)
+{
+	if (!bEnabled)
+		return false;
+
+	BeginFrameIfNeeded();
+
+	const int32* Slot = ResultIndex.Find(Key);
+	if (!Slot)
+	{
+		CacheMisses++;
+		INC_DWORD_STAT(STAT_TargetingQueryCacheMisses);
+		return false;
+	}
+
+	CacheHits++;
+	INC_DWORD_STAT(STAT_TargetingQueryCacheHits);
+
+	// Actors destroyed since the result was stored are skipped
+	for (AActor* Actor : Results[*Slot])
+	{
+		if (IsValid(Actor))
+		{
+			OutTargets.Add(Actor);
+		}
+	}
+
+	return true;
+}
+
+void UTargetingQueryCacheSubsystem::Store(const FTargetingQueryKey& Key, const FTargetingResultArray& Targets)
+{
+	if (!bEnabled)
+		return;
+
+	BeginFrameIfNeeded();
+
+	if (NumResultsUsed == Results.Num())
+	{
+		Results.AddDefaulted();
+	}
+
+	const int32 Slot = NumResultsUsed++;
+	Results[Slot].Reset();
+	Results[Slot].Append(Targets);
+	ResultIndex.Add(Key, Slot);
+}
+
+FIntVector UTargetingQueryCacheSubsystem::QuantizeLocation(const FVector& Location) const
+{
+	const double InvCellSize = 1.0 / FMath::Max(QuantizeCellSize, 1.f);
+	return FIntVector(
+		FMath::FloorToInt(Location.X * InvCellSize),
+		FMath::FloorToInt(Location.Y * InvCellSize),
+		FMath::FloorToInt(Location.Z * InvCellSize));
+}
+
+float UTargetingQueryCacheSubsystem::GetHitRate() const
+{
+	const int32 Total = CacheHits + CacheMisses;
+	return Total > 0 ? static_cast<float>(CacheHits) / Total : 0.f;
+}
+
+void UTargetingQueryCacheSubsystem::BeginFrameIfNeeded()
+{
+	if (CachedFrame == GFrameCounter)
+		return;
+
+	// New frame: everything cached last frame is stale
+	CachedFrame = GFrameCounter;
+	ResultIndex.Reset();
+	NumResultsUsed = 0;
+}
@@ -32,16 +32,29 @@ void AYDGameMode::BeginPlay()
 	if (MinionPool && MinionClass)
 	{
 		MinionPool->InitializePool(MinionClass, InitialPoolSize);
-		UE_LOG(LogTemp, Log, TEXT("GameMode: Initialized MinionPool with %d minions"), InitialPoolSize);
-		GEngine->AddOnScreenDebugMessage(-1, 1.f, FColor::Red, TEXT("MinionPool initialized!"));
+		UE_LOG(LogTemp, Log, TEXT("GameMode: Started MinionPool warm-up for %d minions"), InitialPoolSize);
+		GEngine->AddOnScreenDebugMessage(-1, 1.f, FColor::Red, TEXT("MinionPool warming up!"));
 	}
 	else if (!MinionClass)
 	{
 		UE_LOG(LogTemp, Error, TEXT("GameMode: MinionClass not set! Set it in Blueprint."));
 	}
 
+	// Each additional minion type gets its own sub-pool
+	if (MinionPool)
+	{
+		for (const TPair<TSubclassOf<AEnemy_Base>, FMinionPoolConfig>& Pair : AdditionalMinionPools)
+		{
+			MinionPool->InitializePoolWithConfig(Pair.Key, Pair.Value);
+		}
+	}
+
 	// Initialize Batch Processor
 	BatchProcessor = GetWorld()->GetSubsystem<UMinionBatchProcessor>();
+	if (BatchProcessor)
+	{
+		BatchProcessor->SetDriveMinionMovement(bBatchDriveMinionMovement);
+	}
 
 	SpawnMinionWave();
 }
@@ -72,6 +85,9 @@ void AYDGameMode::SpawnMinionWave()
 
 		FRotator SpawnRotation = Portal->GetActorRotation();
 
+		// Portals with their own minion type draw from that type's sub-pool
+		const TSubclassOf<AEnemy_Base> PortalMinionClass = Portal->GetMinionClass();
+
 		// Get grid spawn positions from portal (5 columns per row)
 		TArray<FVector> GridPositions = Portal->GetGridSpawnPositions(MinionsPerPortal, 5);
 
@@ -82,7 +98,9 @@ void AYDGameMode::SpawnMinionWave()
 		for (int32 i = 0; i < GridPositions.Num(); i++)
 		{
 			FVector SpawnLocation = GridPositions[i];
-			AEnemy_Base* Minion = MinionPool->GetMinion(SpawnLocation, SpawnRotation);
+			AEnemy_Base* Minion = PortalMinionClass
+				? MinionPool->GetMinionOfClass(PortalMinionClass, SpawnLocation, SpawnRotation)
+				: MinionPool->GetMinion(SpawnLocation, SpawnRotation);
 
 			if (Minion)
 			{
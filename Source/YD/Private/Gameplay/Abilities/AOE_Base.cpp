@@ -2,6 +2,8 @@
 
 
 #include "Gameplay/Abilities/AOE_Base.h"
+#include "Core/Subsystems/ActorPoolSubsystem.h"
+#include "TimerManager.h"
 #include "Kismet/KismetStringLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 
@@ -18,6 +20,24 @@ void AAOE_Base::BeginPlay()
 {
 	Super::BeginPlay();
 
+	StartTriggerTimer();
+}
+
+void AAOE_Base::OnAcquiredFromPool()
+{
+	StartTriggerTimer();
+}
+
+void AAOE_Base::OnReturnedToPool()
+{
+	// Bindings belong to the ability that spawned this AOE, and pending triggers must not fire while pooled
+	OnOverlapActor.Clear();
+	OnOverlapActors.Clear();
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+}
+
+void AAOE_Base::StartTriggerTimer()
+{
 	if (bTriggerOnBeginPlay)
 	{
 		// TODO: 0.1sec Delay
@@ -69,14 +89,37 @@ void AAOE_Base::SpawnAOE_Sphere()
 		OverlappedActors
 	);
 
-	for(AActor* Actor : OverlappedActors)
+	if (OverlappedActors.Num() == 0)
+		return;
+
+	OnOverlapActors.Broadcast(OverlappedActors);
+
+	// Per-actor event only for listeners that still use it
+	if (OnOverlapActor.IsBound())
 	{
-		OnOverlapActor.Broadcast(Actor);
+		for (AActor* Actor : OverlappedActors)
+		{
+			OnOverlapActor.Broadcast(Actor);
+		}
 	}
 }
 
 void AAOE_Base::Trigger()
 {
 	SpawnAOE_Sphere();
+
+	// Previously AOE actors were never cleaned up - recycle them once triggered
+	GetWorldTimerManager().SetTimer(
+		ReleaseTimerHandle,
+		this,
+		&AAOE_Base::ReleaseToPool,
+		FMath::Max(ReleaseDelay, KINDA_SMALL_NUMBER),
+		false
+	);
+}
+
+void AAOE_Base::ReleaseToPool()
+{
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
 }
 
@@ -2,6 +2,7 @@
 
 
 #include "Gameplay/Abilities/Projectile_Base.h"
+#include "Core/Subsystems/ActorPoolSubsystem.h"
 
 #include "Chaos/PBDSuspensionConstraintData.h"
 #include "Components/StaticMeshComponent.h"
@@ -11,6 +12,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Particles/ParticleSystem.h"
+#include "TimerManager.h"
 
 // Sets default values
 AProjectile_Base::AProjectile_Base()
@@ -57,6 +59,46 @@ void AProjectile_Base::BeginPlay()
 		ProjectileCollision->BodyInstance.bNotifyRigidBodyCollision ? TEXT("true") : TEXT("false"));
 	UE_LOG(LogTemp, Log, TEXT("Collision Profile: %s"), *ProjectileCollision->GetCollisionProfileName().ToString());
 
+	Launch();
+}
+
+void AProjectile_Base::OnAcquiredFromPool()
+{
+	bInPool = false;
+
+	// Movement stops simulating on impact, so re-attach it to the collision box
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->SetUpdatedComponent(ProjectileCollision);
+		ProjectileMovement->Activate(true);
+	}
+
+	Launch();
+}
+
+void AProjectile_Base::OnReturnedToPool()
+{
+	bInPool = true;
+
+	// Bindings belong to the ability that fired this projectile
+	OnProjectileImpact.Clear();
+
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->bIsHomingProjectile = false;
+		ProjectileMovement->HomingTargetComponent = nullptr;
+		ProjectileMovement->Deactivate();
+	}
+
+	ProjectileCollision->ClearMoveIgnoreActors();
+	Target = nullptr;
+
+	GetWorldTimerManager().ClearTimer(LifetimeTimer);
+}
+
+void AProjectile_Base::Launch()
+{
 	// Set initial velocity from spawn rotation
 	if (ProjectileMovement)
 	{
@@ -78,6 +120,12 @@ void AProjectile_Base::BeginPlay()
 
 	PlaySpawnSound();
 
+	// Release projectiles that never hit anything instead of leaking them out of the pool
+	if (MaxLifetime > 0.f)
+	{
+		GetWorldTimerManager().SetTimer(LifetimeTimer, this, &AProjectile_Base::OnLifetimeExpired, MaxLifetime, false);
+	}
+
 	AActor* ProjectileOwner = GetInstigator();
 	if (!ProjectileOwner)
 		ProjectileOwner = GetOwner();
@@ -207,9 +255,20 @@ void AProjectile_Base::SpawnImpactEffect(FVector Location)
 	);
 }
 
+void AProjectile_Base::OnLifetimeExpired()
+{
+	if (bInPool)
+		return;
+
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
 void AProjectile_Base::OnComponentHit(UPrimitiveComponent* HitComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComponent, FVector NormalImpulse, const FHitResult& Hit)
 {
+	if (bInPool)
+		return;
+
 	// Only process collision if the hit actor has specific tags
 	// Ignore terrain/background objects that don't have tags
 	if (OtherActor)
@@ -238,5 +297,6 @@ void AProjectile_Base::OnComponentHit(UPrimitiveComponent* HitComponent, AActor*
 
 	PlayImpactSound(ImpactLocation);
 
-	Destroy();
+	// Back to the pool instead of destroying
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
 }
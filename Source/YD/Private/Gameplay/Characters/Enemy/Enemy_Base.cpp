@@ -3,7 +3,14 @@
 #include "Gameplay/Characters/Enemy/Enemy_Base.h"
 #include "Gameplay/Components/CharacterStatComponent.h"
 #include "Gameplay/Components/CombatComponent.h"
+#include "Gameplay/Components/TeamComponent.h"
 #include "Gameplay/Data/TargetingStrategy.h"
+#include "Core/Subsystems/MinionFlowFieldSubsystem.h"
+#include "Core/Subsystems/MinionBatchProcessor.h"
+#include "Core/Subsystems/MinionPoolManager.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
+#include "Core/DistanceKernels.h"
+#include "TimerManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
 #include "Kismet/GameplayStatics.h"
@@ -22,8 +29,10 @@ AEnemy_Base::AEnemy_Base()
 	GoldReward = 20;
 	ExperienceReward = 30;
 	DetectionRange = 800.f;
+	bDetectionRequiresLineOfSight = true;
 	DetectionTimer = 0.f;
 	MoveUpdateTimer = 0.f;
+	CorpseDuration = 3.f;
 	MovementTarget = nullptr;
 
 	// Add "Enemy" tag for identification
@@ -70,6 +79,12 @@ void AEnemy_Base::BeginPlay()
 
 	// Initialize TargetingStrategy for enemy detection
 	InitializeTargetingStrategy();
+
+	// Size the hash cells to the detection query so it stays within 3x3 cells
+	if (USpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<USpatialHashSubsystem>())
+	{
+		SpatialHash->ReserveQueryRadius(DetectionRange);
+	}
 }
 
 void AEnemy_Base::InitializeTargetingStrategy()
@@ -84,7 +99,8 @@ void AEnemy_Base::InitializeTargetingStrategy()
 		DetectionConfig.Range = DetectionRange;
 		DetectionConfig.TargetFilter = static_cast<int32>(ETargetFilter::Enemy) | static_cast<int32>(ETargetFilter::Champion);
 		DetectionConfig.MaxTargets = 1; // Only find closest enemy
-		DetectionConfig.bRequiresLineOfSight = false;
+		DetectionConfig.bRequiresLineOfSight = bDetectionRequiresLineOfSight;
+		DetectionConfig.bDeferLineOfSight = true; // Never block detection on a synchronous trace
 
 		EnemyDetectionStrategy->Initialize(DetectionConfig, this);
 	}
@@ -121,6 +137,8 @@ void AEnemy_Base::Tick(float DeltaTime)
 	// If we have a target, handle movement and combat
 	if (CurrentTargetActor)
 	{
+		UMinionFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UMinionFlowFieldSubsystem>();
+
 		// Get attack range for combat
 		UCharacterStatComponent* Stats = FindComponentByClass<UCharacterStatComponent>();
 		float AttackRange = Stats ? Stats->GetCurrentAttackRange() : 150.f;
@@ -135,7 +153,14 @@ void AEnemy_Base::Tick(float DeltaTime)
 				CombatComponent->SetTarget(CurrentTargetActor);
 			}
 			// Stop moving when in attack range
-			UAIBlueprintHelperLibrary::SimpleMoveToLocation(GetController(), GetActorLocation());
+			if (FlowField)
+			{
+				FlowField->StopMovement(GetController());
+			}
+			else
+			{
+				UAIBlueprintHelperLibrary::SimpleMoveToLocation(GetController(), GetActorLocation());
+			}
 		}
 		else
 		{
@@ -146,7 +171,14 @@ void AEnemy_Base::Tick(float DeltaTime)
 			if (MoveUpdateTimer >= 0.2f)
 			{
 				MoveUpdateTimer = 0.f;
-				UAIBlueprintHelperLibrary::SimpleMoveToActor(GetController(), CurrentTargetActor);
+				if (FlowField)
+				{
+					FlowField->MoveToActor(GetController(), CurrentTargetActor);
+				}
+				else
+				{
+					UAIBlueprintHelperLibrary::SimpleMoveToActor(GetController(), CurrentTargetActor);
+				}
 			}
 		}
 	}
@@ -157,10 +189,28 @@ void AEnemy_Base::OnDeath(AActor* Killer)
 	// Broadcast death event for reward handling
 	OnEnemyDeath.Broadcast(this, Killer);
 
+	UWorld* World = GetWorld();
+
+	// Leave batch processing now instead of leaving a dead row behind
+	if (UMinionBatchProcessor* BatchProcessor = World->GetSubsystem<UMinionBatchProcessor>())
+	{
+		BatchProcessor->UnregisterMinion(this);
+	}
+
+	// Corpses don't search or chase - pool activation turns tick back on
+	SetActorTickEnabled(false);
+
 	// Stop all movement
 	if (AController* MyController = GetController())
 	{
-		UAIBlueprintHelperLibrary::SimpleMoveToLocation(MyController, GetActorLocation());
+		if (UMinionFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UMinionFlowFieldSubsystem>())
+		{
+			FlowField->StopMovement(MyController);
+		}
+		else
+		{
+			UAIBlueprintHelperLibrary::SimpleMoveToLocation(MyController, GetActorLocation());
+		}
 	}
 
 	// Clear combat target
@@ -172,8 +222,24 @@ void AEnemy_Base::OnDeath(AActor* Killer)
 	// TODO: Play death animation, spawn death effects, etc.
 	UE_LOG(LogTemp, Log, TEXT("Enemy %s killed by %s"), *GetName(), Killer ? *Killer->GetName() : TEXT("Unknown"));
 
-	// Destroy after delay (for death animation)
-	SetLifeSpan(3.0f);
+	// Return to the pool after a delay (for death animation), destroy if not pooled
+	UMinionPoolManager* MinionPool = World->GetSubsystem<UMinionPoolManager>();
+	if (MinionPool && MinionPool->IsActivePooledMinion(this))
+	{
+		GetWorldTimerManager().SetTimer(CorpseTimerHandle, this, &AEnemy_Base::ReturnToPool, FMath::Max(CorpseDuration, KINDA_SMALL_NUMBER), false);
+	}
+	else
+	{
+		SetLifeSpan(CorpseDuration);
+	}
+}
+
+void AEnemy_Base::ReturnToPool()
+{
+	if (UMinionPoolManager* MinionPool = GetWorld()->GetSubsystem<UMinionPoolManager>())
+	{
+		MinionPool->ReturnMinion(this);
+	}
 }
 
 void AEnemy_Base::SetMovementTarget(AActor* NewTarget)
@@ -195,11 +261,12 @@ void AEnemy_Base::SearchForEnmies()
 	FAbilityTargetData TargetData;
 	TargetData.bIsValid = true; // For Auto targeting
 
-	TArray<AActor*> PotentialEnemies = EnemyDetectionStrategy->GetValidTargets(TargetData);
+	FTargetingResultArray PotentialEnemies;
+	EnemyDetectionStrategy->GetValidTargets(TargetData, PotentialEnemies);
 
-	// Filter out dead enemies and find closest alive enemy
-	AActor* ClosestEnemy = nullptr;
-	float ClosestDistance = DetectionRange;
+	// Filter out dead enemies, then find the closest alive one with the SIMD argmin kernel
+	TSoAPositions<TargetingInlineCapacity> AlivePositions;
+	FTargetingResultArray AliveEnemies;
 
 	for (AActor* Enemy : PotentialEnemies)
 	{
@@ -211,15 +278,13 @@ void AEnemy_Base::SearchForEnmies()
 		if (!TargetStats || !TargetStats->IsAlive())
 			continue;
 
-		// Find closest enemy
-		float Distance = FVector::Dist(GetActorLocation(), Enemy->GetActorLocation());
-		if (Distance < ClosestDistance)
-		{
-			ClosestDistance = Distance;
-			ClosestEnemy = Enemy;
-		}
+		AlivePositions.Add(Enemy->GetActorLocation());
+		AliveEnemies.Add(Enemy);
 	}
 
+	const int32 ClosestIndex = AlivePositions.FindNearest(FVector3f(GetActorLocation()), DetectionRange * DetectionRange);
+	AActor* ClosestEnemy = ClosestIndex != INDEX_NONE ? AliveEnemies[ClosestIndex] : nullptr;
+
 	// Attack closest enemy if found
 	if (ClosestEnemy && CombatComponent)
 	{
@@ -233,8 +298,8 @@ bool AEnemy_Base::IsEnemy(AActor* Actor) const
 	if (!Actor)
 		return false;
 
-	// Enemies attack players (anything without "Enemy" tag)
-	return !Actor->ActorHasTag(FName("Enemy"));
+	// Enemies attack anything not on their team
+	return UTeamComponent::AreEnemies(this, Actor);
 }
 
 void AEnemy_Base::HandleDeath()
@@ -3,6 +3,8 @@
 #include "GamePlay/Characters/Player/YDCharacter.h"
 #include "Gameplay/Components/CharacterStatComponent.h"
 #include "Gameplay/Components/CombatComponent.h"
+#include "Gameplay/Components/TeamComponent.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
 #include "Engine/LocalPlayer.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -38,6 +40,9 @@ AYDCharacter::AYDCharacter()
 	// Create combat component
 	CombatComponent = CreateDefaultSubobject<UCombatComponent>(TEXT("CombatComponent"));
 
+	// Create team component (team and unit type cached from tags on register)
+	TeamComponent = CreateDefaultSubobject<UTeamComponent>(TEXT("TeamComponent"));
+
 	// Note: The skeletal mesh and anim blueprint references on the Mesh component (inherited from Character)
 	// can now be set via CharacterData asset for a fully data-driven approach
 }
@@ -47,4 +52,22 @@ void AYDCharacter::BeginPlay()
 	// Call the base class
 	Super::BeginPlay();
 
+	// Register for proximity queries (targeting, minion AI)
+	if (USpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<USpatialHashSubsystem>())
+	{
+		SpatialHash->RegisterActor(this);
+	}
+}
+
+void AYDCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (USpatialHashSubsystem* SpatialHash = World->GetSubsystem<USpatialHashSubsystem>())
+		{
+			SpatialHash->UnregisterActor(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
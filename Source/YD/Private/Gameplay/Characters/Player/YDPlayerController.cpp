@@ -3,6 +3,7 @@
 #include "GamePlay/Characters/Player/YDPlayerController.h"
 #include "GamePlay/Characters/Player/YDCharacter.h"
 #include "Gameplay/Components/CombatComponent.h"
+#include "Gameplay/Components/TeamComponent.h"
 #include "Gameplay/Components/AbilityComponent.h"
 #include "Gameplay/Data/Ability.h"
 #include "Gameplay/Data/AbilityTypes.h"
@@ -196,13 +197,11 @@ void AYDPlayerController::AttackTarget(AActor* Target)
 
 bool AYDPlayerController::IsEnemy(AActor* Actor)
 {
-	// TODO: Implement proper enemy detection
-	// For now, check if actor has "Enemy" tag
-	if (Actor)
-	{
-		return Actor->ActorHasTag(FName("Enemy"));
-	}
-	return false;
+	// Teamless actors (terrain, props) are never attack targets
+	if (!Actor || UTeamComponent::GetTeamId(Actor) == 0)
+		return false;
+
+	return UTeamComponent::AreEnemies(GetPawn(), Actor);
 }
 
 void AYDPlayerController::HandleCameraEdgeScrolling(float DeltaTime)
@@ -316,13 +315,13 @@ void AYDPlayerController::OnQSkillTriggered()
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("Q Ability found - Level: %d, Cooldown: %.1f"),
-		QAbility->CurrentLevel, QAbility->RemainingCooldown);
+		QAbility->CurrentLevel, QAbility->GetRemainingCooldown());
 
 	if (!QAbility->CanCast())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Q Ability cannot be cast:"));
 		UE_LOG(LogTemp, Warning, TEXT("  - Level: %d (needs > 0)"), QAbility->CurrentLevel);
-		UE_LOG(LogTemp, Warning, TEXT("  - Cooldown: %.1fs"), QAbility->RemainingCooldown);
+		UE_LOG(LogTemp, Warning, TEXT("  - Cooldown: %.1fs"), QAbility->GetRemainingCooldown());
 		UE_LOG(LogTemp, Warning, TEXT("  - IsCasting: %s"), QAbility->bIsCasting ? TEXT("Yes") : TEXT("No"));
 		return;
 	}
@@ -346,19 +345,11 @@ void AYDPlayerController::OnQSkillTriggered()
 	TargetData.TargetLocation = HitResult.Location;
 	TargetData.Direction = (HitResult.Location - ControlledPawn->GetActorLocation()).GetSafeNormal();
 
-	// Include actor only if it has gameplay-relevant tags
+	// Include actor only if it is a gameplay actor (team/unit type cached by UTeamComponent)
 	AActor* HitActor = HitResult.GetActor();
 	if (HitActor)
 	{
-		bool bHasGameplayTag = HitActor->Tags.Contains(FName("Enemy")) ||
-		                       HitActor->Tags.Contains(FName("Structure")) ||
-		                       HitActor->Tags.Contains(FName("Character")) ||
-		                       HitActor->Tags.Contains(FName("Minion")) ||
-		                       HitActor->Tags.Contains(FName("Champion")) ||
-		                       HitActor->Tags.Contains(FName("Neutral")) ||
-		                       HitActor->Tags.Contains(FName("Player"));
-
-		if (bHasGameplayTag)
+		if (UTeamComponent::IsTargetable(HitActor))
 		{
 			TargetData.TargetActor = HitActor;
 			UE_LOG(LogTemp, Log, TEXT("Cursor hit valid target: %s at %s"), *HitActor->GetName(), *HitResult.Location.ToString());
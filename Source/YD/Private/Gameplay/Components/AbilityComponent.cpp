@@ -13,7 +13,8 @@
 
 UAbilityComponent::UAbilityComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Cooldowns expire through UCooldownTimelineSubsystem and pending casts through spatial hash range triggers
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
 }
 
@@ -49,21 +50,6 @@ void UAbilityComponent::InitializeAbilities()
 	}
 }
 
-void UAbilityComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Update cooldowns and check pending executions
-	for (UAbility* Ability : Abilities)
-	{
-		if (Ability)
-		{
-			Ability->UpdateCooldown(DeltaTime);
-			Ability->CheckPendingExecution();
-		}
-	}
-}
-
 UAbility* UAbilityComponent::GetAbility(EAbilitySlot Slot) const
 {
 	int32 Index = static_cast<int32>(Slot);
@@ -0,0 +1,188 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Gameplay/Components/TeamComponent.h"
+#include "Gameplay/Characters/Player/YDCharacter.h"
+#include "Gameplay/Data/TargetingStrategy.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+UTeamComponent::UTeamComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UTeamComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (bDeriveFromTags)
+	{
+		RefreshFromTags();
+	}
+	else
+	{
+		Info.TeamId = static_cast<uint8>(Team);
+		Info.UnitTypeMask = UnitTypeMask;
+		Info.bTargetable = true;
+	}
+}
+
+void UTeamComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	AActor* Owner = GetOwner();
+	if (!bRegisterWithSpatialHash || !Info.bTargetable || !Owner || Owner->IsA<AYDCharacter>())
+		return;
+
+	if (USpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<USpatialHashSubsystem>())
+	{
+		SpatialHash->RegisterActor(Owner);
+		bRegisteredWithSpatialHash = true;
+	}
+}
+
+void UTeamComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRegisteredWithSpatialHash)
+	{
+		if (USpatialHashSubsystem* SpatialHash = GetWorld() ? GetWorld()->GetSubsystem<USpatialHashSubsystem>() : nullptr)
+		{
+			SpatialHash->UnregisterActor(GetOwner());
+		}
+		bRegisteredWithSpatialHash = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTeamComponent::SetTeam(EYDTeam NewTeam)
+{
+	Team = NewTeam;
+	Info.TeamId = static_cast<uint8>(NewTeam);
+}
+
+void UTeamComponent::RefreshFromTags()
+{
+	Info = ComputeFromTags(GetOwner());
+	Team = static_cast<EYDTeam>(Info.TeamId);
+	UnitTypeMask = Info.UnitTypeMask;
+}
+
+FTeamInfo UTeamComponent::GetTeamInfo(const AActor* Actor)
+{
+	if (!Actor)
+		return FTeamInfo();
+
+	// Characters carry the component directly - no component search
+	if (const AYDCharacter* Character = Cast<AYDCharacter>(Actor))
+	{
+		if (const UTeamComponent* TeamComponent = Character->GetTeamComponent())
+			return TeamComponent->Info;
+	}
+	else if (const UTeamComponent* TeamComponent = Actor->FindComponentByClass<UTeamComponent>())
+	{
+		return TeamComponent->Info;
+	}
+
+	return ComputeFromTags(Actor);
+}
+
+FTeamInfo UTeamComponent::ComputeFromTags(const AActor* Actor)
+{
+	FTeamInfo Result;
+	if (!Actor)
+		return Result;
+
+	bool bHasCharacterTag = false;
+
+	// One pass over the tags instead of one Contains per tag
+	for (const FName& Tag : Actor->Tags)
+	{
+		if (Tag == FName("Enemy"))
+		{
+			Result.TeamId = static_cast<uint8>(EYDTeam::Enemy);
+		}
+		else if (Tag == FName("Player"))
+		{
+			if (Result.TeamId == 0)
+			{
+				Result.TeamId = static_cast<uint8>(EYDTeam::Player);
+			}
+		}
+		else if (Tag == FName("Champion"))
+		{
+			if (Result.TeamId == 0)
+			{
+				Result.TeamId = static_cast<uint8>(EYDTeam::Player);
+			}
+			Result.UnitTypeMask |= static_cast<int32>(ETargetFilter::Champion);
+		}
+		else if (Tag == FName("Minion"))
+		{
+			Result.UnitTypeMask |= static_cast<int32>(ETargetFilter::Minion);
+		}
+		else if (Tag == FName("Structure"))
+		{
+			Result.UnitTypeMask |= static_cast<int32>(ETargetFilter::Structure);
+		}
+		else if (Tag == FName("Neutral"))
+		{
+			Result.UnitTypeMask |= static_cast<int32>(ETargetFilter::Neutral);
+		}
+		else if (Tag == FName("Character"))
+		{
+			bHasCharacterTag = true;
+		}
+	}
+
+	Result.bTargetable = Result.TeamId != 0 || Result.UnitTypeMask != 0 || bHasCharacterTag;
+	return Result;
+}
+
+bool UTeamComponent::AreAllies(const AActor* A, const AActor* B)
+{
+	if (!A || !B)
+		return false;
+
+	if (A == B)
+		return true;
+
+	const uint8 TeamA = GetTeamId(A);
+	return TeamA != 0 && TeamA == GetTeamId(B);
+}
+
+int32 UTeamComponent::ClassifyTarget(const AActor* Target, const AActor* Observer)
+{
+	return ClassifyTarget(Target, Observer, GetTeamId(Observer));
+}
+
+int32 UTeamComponent::ClassifyTarget(const AActor* Target, const AActor* Observer, uint8 ObserverTeamId)
+{
+	if (!Target)
+		return 0;
+
+	const FTeamInfo TargetInfo = GetTeamInfo(Target);
+	int32 Mask = TargetInfo.UnitTypeMask;
+
+	// No observer: only the unit type is known
+	if (!Observer)
+		return Mask;
+
+	if (Target == Observer)
+	{
+		// Self counts as an ally, never as an enemy
+		Mask |= static_cast<int32>(ETargetFilter::Self) | static_cast<int32>(ETargetFilter::Ally);
+	}
+	else if (TargetInfo.TeamId != 0 && TargetInfo.TeamId == ObserverTeamId)
+	{
+		Mask |= static_cast<int32>(ETargetFilter::Ally);
+	}
+	else
+	{
+		Mask |= static_cast<int32>(ETargetFilter::Enemy);
+	}
+
+	return Mask;
+}
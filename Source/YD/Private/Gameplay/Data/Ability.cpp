@@ -4,8 +4,13 @@
 
 #include "Gameplay/Abilities/Projectile_Base.h"
 #include "Gameplay/Abilities/AOE_Base.h"
+#include "Core/Subsystems/ActorPoolSubsystem.h"
+#include "Core/Subsystems/AbilityDefinitionSubsystem.h"
+#include "Core/Subsystems/CooldownTimelineSubsystem.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
 #include "Gameplay/Components/AbilityComponent.h"
 #include "Gameplay/Data/AbilityData.h"
+#include "Gameplay/Data/AbilityDefinition.h"
 #include "Gameplay/Data/AbilityEffect.h"
 #include "Gameplay/Data/AbilityTypes.h"
 #include "GameFramework/ProjectileMovementComponent.h"
@@ -14,6 +19,7 @@
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 #include "Gameplay/Components/CharacterStatComponent.h"
+#include "Gameplay/Components/TeamComponent.h"
 #include "Kismet/GameplayStatics.h"
 
 void UAbility::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -21,7 +27,7 @@ void UAbility::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetime
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(UAbility, CurrentLevel);
-	DOREPLIFETIME(UAbility, RemainingCooldown);
+	DOREPLIFETIME(UAbility, CooldownEndTime);
 	DOREPLIFETIME(UAbility, CurrentCharges);
 	DOREPLIFETIME(UAbility, bIsCasting);
 }
@@ -36,13 +42,13 @@ void UAbility::Execute(const FAbilityTargetData& TargetData)
 	if (!ValidateTargetData(TargetData))
 	{
 		// Check if it's ONLY a range issue and target is otherwise valid
-		if (TargetData.TargetActor && TargetingStrategy &&
+		if (TargetData.TargetActor && GetTargetingStrategy() &&
 			(AbilityData->TargetingConfig.TargetingType == ETargetingType::Unit ||
 			 AbilityData->TargetingConfig.TargetingType == ETargetingType::UnitAOE))
 		{
 			// Check if target is valid except for range
 			float Distance = FVector::Dist(OwningActor->GetActorLocation(), TargetData.TargetActor->GetActorLocation());
-			float Range = AbilityData->TargetingConfig.Range;
+			float Range = GetRange();
 
 			if (Distance > Range)
 			{
@@ -53,6 +59,15 @@ void UAbility::Execute(const FAbilityTargetData& TargetData)
 				bHasPendingExecution = true;
 				PendingExecutionTargetData = TargetData;
 
+				// 사거리 진입 트리거 등록 - 시전자가 GetRange() 안으로 들어오는 틱에 CheckPendingExecution 호출
+				RemovePendingRangeTrigger();
+				if (USpatialHashSubsystem* SpatialHash = GetWorld() ? GetWorld()->GetSubsystem<USpatialHashSubsystem>() : nullptr)
+				{
+					PendingRangeTrigger = SpatialHash->AddRangeTrigger(OwningActor, TargetData.TargetActor, Range,
+						FSimpleDelegate::CreateUObject(this, &UAbility::CheckPendingExecution),
+						FSimpleDelegate::CreateUObject(this, &UAbility::CancelPendingExecution));
+				}
+
 				// Command character to move toward target
 				if (APawn* PawnOwner = Cast<APawn>(OwningActor))
 				{
@@ -93,6 +108,7 @@ void UAbility::Execute(const FAbilityTargetData& TargetData)
 
 bool UAbility::ValidateTargetData(const FAbilityTargetData& TargetData) const
 {
+	UTargetingStrategy* TargetingStrategy = GetTargetingStrategy();
 	if (!TargetingStrategy || !AbilityData)
 		return false;
 
@@ -112,6 +128,7 @@ bool UAbility::ValidateTargetData(const FAbilityTargetData& TargetData) const
 			}
 
 			// Validate the target against filters
+			FTargetingStrategyBinding Binding(*TargetingStrategy, OwningActor, GetRange());
 			if (!TargetingStrategy->ValidateTarget(TargetData.TargetActor))
 			{
 				UE_LOG(LogTemp, Warning, TEXT("Target %s failed validation (not matching filters)"),
@@ -155,70 +172,69 @@ void UAbility::Initialize(UAbilityData* InData, AActor* Owner, EAbilitySlot Slot
 	OwningActor = Owner;
 	AbilitySlot = Slot;
 	OwningComponent = Owner->FindComponentByClass<UAbilityComponent>();
+	OwnerStats = Owner->FindComponentByClass<UCharacterStatComponent>();
+
+	UWorld* World = Owner->GetWorld();
+	CooldownTimeline = World ? World->GetSubsystem<UCooldownTimelineSubsystem>() : nullptr;
 
 	CurrentCharges = AbilityData->MaxCharges;
 
-	CreateTargetingStrategy();
-	CreateRuntimeEffects();
+	ResolveDefinition();
+	CreateCustomTargetingStrategy();
+	RefreshLevelStats();
 }
 
 void UAbility::LevelUp()
 {
 	CurrentLevel++;
+	RefreshLevelStats();
 }
 
-void UAbility::CreateTargetingStrategy()
+void UAbility::RefreshLevelStats()
 {
-	if (!AbilityData)
-		return;
-
-	if (AbilityData->CustomTargetingClass)
-	{
-		TargetingStrategy = NewObject<UTargetingStrategy>(this, AbilityData->CustomTargetingClass);
-	}
-	else
-	{
-		TargetingStrategy = NewObject<UTargetingStrategy>(this);
-	}
+	LevelStats = Definition ? Definition->GetLevelStats(CurrentLevel) : FAbilityLevelStats();
+}
 
-	// Config 초기화
-	if (TargetingStrategy)
-	{
-		TargetingStrategy->Initialize(AbilityData->TargetingConfig, OwningActor);
-	}
+void UAbility::OnRep_CurrentLevel()
+{
+	RefreshLevelStats();
 }
 
-void UAbility::CreateRuntimeEffects()
+void UAbility::ResolveDefinition()
 {
 	if (!AbilityData)
+		return;
+
+	UWorld* World = OwningActor ? OwningActor->GetWorld() : nullptr;
+	if (UAbilityDefinitionSubsystem* Definitions = World ? World->GetSubsystem<UAbilityDefinitionSubsystem>() : nullptr)
 	{
-		UE_LOG(LogTemp, Error, TEXT("CreateRuntimeEffects: AbilityData is null"));
+		Definition = Definitions->GetDefinition(AbilityData);
 		return;
 	}
 
-	RuntimeEffects.Empty();
+	// 월드 캐시 없음 (에디터 유틸리티 등) - 이 인스턴스 전용으로 컴파일
+	Definition = NewObject<UAbilityDefinition>(this);
+	Definition->Compile(AbilityData);
+}
 
-	UE_LOG(LogTemp, Log, TEXT("Creating Runtime Effects for %s - Effects count in data: %d"),
-		*AbilityData->AbilityName.ToString(), AbilityData->Effects.Num());
+void UAbility::CreateCustomTargetingStrategy()
+{
+	CustomTargetingStrategy = nullptr;
 
-	for (int32 i = 0; i < AbilityData->Effects.Num(); i++)
+	// 커스텀 전략은 소유자를 기대할 수 있으므로 공유하지 않음
+	if (AbilityData && AbilityData->CustomTargetingClass)
 	{
-		const FAbilityEffectData& EffectData = AbilityData->Effects[i];
-		if (EffectData.EffectClass)
-		{
-			UAbilityEffect* NewEffect = NewObject<UAbilityEffect>(this, EffectData.EffectClass);
-			NewEffect->InitializeFromData(EffectData, this);
-			RuntimeEffects.Add(NewEffect);
-			UE_LOG(LogTemp, Log, TEXT("  Created Effect %d: %s (BaseValue: %.1f)"),
-				i, *EffectData.EffectClass->GetName(), EffectData.BaseValue);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("  Effect %d has no EffectClass set!"), i);
-		}
+		CustomTargetingStrategy = NewObject<UTargetingStrategy>(this, AbilityData->CustomTargetingClass);
+		CustomTargetingStrategy->Initialize(AbilityData->TargetingConfig, OwningActor);
 	}
+}
 
-	UE_LOG(LogTemp, Log, TEXT("Total RuntimeEffects created: %d"), RuntimeEffects.Num());
+UTargetingStrategy* UAbility::GetTargetingStrategy() const
+{
+	if (CustomTargetingStrategy)
+		return CustomTargetingStrategy;
+
+	return Definition ? Definition->TargetingStrategy : nullptr;
 }
 
 void UAbility::StartCasting(const FAbilityTargetData& TargetData)
@@ -339,12 +355,17 @@ void UAbility::RotateOwnerToTarget(const FAbilityTargetData& TargetData)
 
 void UAbility::ExecuteInstant(const FAbilityTargetData& TargetData)
 {
-	TArray<AActor*> Targets = GetValidTargetsFromData(TargetData);
+	UTargetingStrategy* TargetingStrategy = GetTargetingStrategy();
+	if (!TargetingStrategy)
+		return;
 
-	for (AActor* Actor : Targets)
+	FTargetingResultArray Targets;
 	{
-		ApplyEffectsToActor(Actor);
+		FTargetingStrategyBinding Binding(*TargetingStrategy, OwningActor, GetRange());
+		TargetingStrategy->GetValidTargets(TargetData, Targets);
 	}
+
+	ApplyEffectsToTargets(Targets);
 }
 
 void UAbility::ExecuteProjectile(const FAbilityTargetData& TargetData)
@@ -416,32 +437,20 @@ void UAbility::ExecuteProjectile(const FAbilityTargetData& TargetData)
 
 	if (UWorld* World = GetWorld())
 	{
-		AProjectile_Base* Projectile = World->SpawnActor<AProjectile_Base>(
-			DeliveryConfig.ProjectileClass,
-			SpawnLocation,
-			SpawnRotation,
-			SpawnParams
-		);
-
-		if (Projectile)
-		{
-			// 투사체 충돌 이벤트 바인딩
-			Projectile->OnProjectileImpact.AddDynamic(this, &UAbility::OnProjectileHit);
-
-			// 속도, 호밍 등 설정
-			if (Projectile->ProjectileMovement)
+		// Reuse pooled projectiles instead of spawning one per cast - configured before it launches
+		AProjectile_Base* Projectile = UActorPoolSubsystem::AcquireOrSpawn<AProjectile_Base>(
+			World, DeliveryConfig.ProjectileClass, SpawnLocation, SpawnRotation, SpawnParams.Owner, SpawnParams.Instigator,
+			[this, &TargetData](AProjectile_Base* NewProjectile)
 			{
-				Projectile->ProjectileMovement->InitialSpeed = DeliveryConfig.ProjectileSpeed;
-				Projectile->ProjectileMovement->MaxSpeed = DeliveryConfig.ProjectileSpeed;
+				// 투사체 충돌 이벤트 바인딩
+				NewProjectile->OnProjectileImpact.AddDynamic(this, &UAbility::OnProjectileHit);
 
-				if (DeliveryConfig.bIsHoming && TargetData.TargetActor)
-				{
-					Projectile->ProjectileMovement->bIsHomingProjectile = true;
-					Projectile->ProjectileMovement->HomingAccelerationMagnitude = DeliveryConfig.HomingAcceleration;
-					Projectile->ProjectileMovement->HomingTargetComponent = TargetData.TargetActor->GetRootComponent();
-				}
-			}
+				// 속도, 호밍 등 설정
+				ConfigureProjectile(NewProjectile, TargetData.TargetActor);
+			});
 
+		if (Projectile)
+		{
 			UE_LOG(LogTemp, Warning, TEXT("Projectile spawned with speed: %.1f"), DeliveryConfig.ProjectileSpeed);
 		}
 	}
@@ -449,6 +458,24 @@ void UAbility::ExecuteProjectile(const FAbilityTargetData& TargetData)
 	PlayPresentation(SpawnLocation);
 }
 
+void UAbility::ConfigureProjectile(AProjectile_Base* Projectile, AActor* HomingTarget) const
+{
+	if (!AbilityData || !Projectile->ProjectileMovement)
+		return;
+
+	const FAbilityDeliveryConfig& DeliveryConfig = AbilityData->DeliveryConfig;
+
+	Projectile->ProjectileMovement->InitialSpeed = DeliveryConfig.ProjectileSpeed;
+	Projectile->ProjectileMovement->MaxSpeed = DeliveryConfig.ProjectileSpeed;
+
+	if (DeliveryConfig.bIsHoming && HomingTarget)
+	{
+		Projectile->ProjectileMovement->bIsHomingProjectile = true;
+		Projectile->ProjectileMovement->HomingAccelerationMagnitude = DeliveryConfig.HomingAcceleration;
+		Projectile->ProjectileMovement->HomingTargetComponent = HomingTarget->GetRootComponent();
+	}
+}
+
 void UAbility::ExecuteAOE(const FAbilityTargetData& TargetData)
 {
 	if (!AbilityData || !OwningActor)
@@ -467,17 +494,15 @@ void UAbility::ExecuteAOE(const FAbilityTargetData& TargetData)
 
 	if (UWorld* World = GetWorld())
 	{
-		AAOE_Base* AOE = World->SpawnActor<AAOE_Base>(
-			DeliveryConfig.AOEIndicatorClass,
-			SpawnLocation,
-			FRotator::ZeroRotator,
-			SpawnParams
-		);
+		UActorPoolSubsystem* ActorPool = World->GetSubsystem<UActorPoolSubsystem>();
+		AAOE_Base* AOE = ActorPool
+			? ActorPool->Acquire<AAOE_Base>(DeliveryConfig.AOEIndicatorClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams.Owner, SpawnParams.Instigator)
+			: World->SpawnActor<AAOE_Base>(DeliveryConfig.AOEIndicatorClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
 
 		if (AOE)
 		{
 			// AOE 오버랩 이벤트 바인딩
-			AOE->OnOverlapActor.AddDynamic(this, &UAbility::OnAOEOverlap);
+			AOE->OnOverlapActors.AddDynamic(this, &UAbility::OnAOEOverlap);
 
 			if (DeliveryConfig.DeliveryType == EAbilityDeliveryType::DelayedAOE)
 			{
@@ -504,27 +529,46 @@ void UAbility::ExecuteAOE(const FAbilityTargetData& TargetData)
 
 void UAbility::ApplyEffectsToActor(AActor* Target)
 {
-	if (!Target || !OwningActor)
-	{
-		UE_LOG(LogTemp, Error, TEXT("ApplyEffectsToActor: Target or OwningActor is null"));
+	if (!Target)
+		return;
+
+	ApplyEffectsToTargets(MakeArrayView(&Target, 1));
+}
+
+void UAbility::ApplyEffectsToTargets(TArrayView<AActor* const> Targets)
+{
+	if (!OwningActor || !Definition || Targets.Num() == 0)
 		return;
+
+	// 시전자 스탯과 시전 컨텍스트는 배치당 한 번 (공유 이펙트는 이 인스턴스를 모름)
+	const FEffectInstigatorSnapshot Snapshot = FEffectInstigatorSnapshot::Capture(OwningActor, OwnerStats, this, GetDamageMultiplier());
+
+	// 대상 스탯 컴포넌트는 이펙트 수와 무관하게 대상당 한 번
+	TArray<FEffectBatchTarget, TInlineAllocator<TargetingInlineCapacity>> BatchTargets;
+	BatchTargets.Reserve(Targets.Num());
+	for (AActor* Target : Targets)
+	{
+		if (!IsValid(Target))
+			continue;
+
+		FEffectBatchTarget& BatchTarget = BatchTargets.AddDefaulted_GetRef();
+		BatchTarget.Actor = Target;
+		BatchTarget.Stats = FEffectBatchTarget::ResolveStats(Target);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("=== Applying %d Effects to %s ==="), RuntimeEffects.Num(), *Target->GetName());
+	if (BatchTargets.Num() == 0)
+		return;
 
-	for (int32 i = 0; i < RuntimeEffects.Num(); i++)
+	for (UAbilityEffect* Effect : Definition->Effects)
 	{
-		UAbilityEffect* Effect = RuntimeEffects[i];
 		if (Effect)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Applying Effect %d: %s"), i, *Effect->GetClass()->GetName());
-			Effect->Apply(Target, OwningActor);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Effect %d is null"), i);
+			Effect->ApplyBatch(BatchTargets, Snapshot);
 		}
 	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("%s applied %d effects to %d targets"),
+		*AbilityData->AbilityName.ToString(), Definition->Effects.Num(), BatchTargets.Num());
 }
 
 // ============================================
@@ -533,26 +577,17 @@ void UAbility::ApplyEffectsToActor(AActor* Target)
 
 void UAbility::OnProjectileHit(AActor* HitActor, FHitResult Hit)
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== OnProjectileHit Callback ==="));
-	UE_LOG(LogTemp, Log, TEXT("Hit Actor: %s"), HitActor ? *HitActor->GetName() : TEXT("None"));
-	UE_LOG(LogTemp, Log, TEXT("RuntimeEffects count: %d"), RuntimeEffects.Num());
+	UE_LOG(LogTemp, Verbose, TEXT("OnProjectileHit: %s"), HitActor ? *HitActor->GetName() : TEXT("None"));
 
 	if (HitActor)
 	{
 		ApplyEffectsToActor(HitActor);
 	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("HitActor is null!"));
-	}
 }
 
-void UAbility::OnAOEOverlap(AActor* OverlappedActor)
+void UAbility::OnAOEOverlap(const TArray<AActor*>& OverlappedActors)
 {
-	if (OverlappedActor)
-	{
-		ApplyEffectsToActor(OverlappedActor);
-	}
+	ApplyEffectsToTargets(OverlappedActors);
 }
 
 // ============================================
@@ -565,9 +600,9 @@ void UAbility::ConsumeResources()
 		return;
 
 	// 마나 소비 구현
-	if (UCharacterStatComponent* Resource = OwningActor->FindComponentByClass<UCharacterStatComponent>())
+	if (OwnerStats)
 	{
-	     Resource->UseMana(GetManaCost());
+		OwnerStats->UseMana(GetManaCost());
 	}
 
 	// 충전 소비
@@ -580,14 +615,20 @@ void UAbility::ConsumeResources()
 void UAbility::RefundResources()
 {
 	// 마나 환불 구현
-	if (UCharacterStatComponent* Resource = OwningActor->FindComponentByClass<UCharacterStatComponent>())
+	if (OwnerStats)
 	{
-		Resource->RestoreMana(GetManaCost());
+		OwnerStats->RestoreMana(GetManaCost());
 	}
 	// 충전 환불
 	if (AbilityData->MaxCharges > 1)
 	{
 		CurrentCharges = FMath::Min(AbilityData->MaxCharges, CurrentCharges + 1);
+
+		// 다시 가득 찼으면 진행 중인 충전 쿨다운은 필요 없음
+		if (CurrentCharges >= AbilityData->MaxCharges)
+		{
+			ClearCooldown();
+		}
 	}
 }
 
@@ -599,17 +640,56 @@ void UAbility::StartCooldown()
 	// 충전 시스템이 있으면 충전당 쿨다운
 	if (AbilityData->MaxCharges > 1)
 	{
-		// 충전이 최대가 아니면 쿨다운 시작
-		if (CurrentCharges < AbilityData->MaxCharges)
+		// 충전이 최대가 아니고 진행 중인 충전 쿨다운이 없을 때만 시작
+		if (CurrentCharges < AbilityData->MaxCharges && GetRemainingCooldown() <= 0.0f)
 		{
-			RemainingCooldown = GetCooldown();
+			ScheduleCooldown(GetCooldown());
 		}
 	}
 	else
 	{
 		// 일반 쿨다운
-		RemainingCooldown = GetCooldown();
+		ScheduleCooldown(GetCooldown());
+	}
+}
+
+void UAbility::ScheduleCooldown(float Duration)
+{
+	CooldownSerial++;
+
+	if (!CooldownTimeline || Duration <= 0.0f)
+	{
+		CooldownEndTime = 0.0;
+		return;
+	}
+
+	CooldownEndTime = CooldownTimeline->GetTime() + Duration;
+	CooldownTimeline->Schedule(this, CooldownEndTime, CooldownSerial);
+}
+
+void UAbility::ClearCooldown()
+{
+	CooldownSerial++;
+	CooldownEndTime = 0.0;
+}
+
+void UAbility::OnCooldownExpired()
+{
+	CooldownEndTime = 0.0;
+
+	// 충전 시스템: 쿨다운 완료 시 충전 회복
+	if (AbilityData && AbilityData->MaxCharges > 1)
+	{
+		CurrentCharges = FMath::Min(AbilityData->MaxCharges, CurrentCharges + 1);
+
+		// 아직 충전이 최대가 아니면 다음 충전 쿨다운 시작
+		if (CurrentCharges < AbilityData->MaxCharges)
+		{
+			ScheduleCooldown(GetCooldown());
+		}
 	}
+
+	OnCooldownEnded.Broadcast(this);
 }
 
 // ============================================
@@ -641,11 +721,8 @@ bool UAbility::CanCast() const
 		return false;
 
 	// 마나 체크
-	if (UCharacterStatComponent* Resource = OwningActor->FindComponentByClass<UCharacterStatComponent>())
-	{
-		if (GetManaCost() > Resource->CurrentMana)
-			return false;
-	}
+	if (OwnerStats && LevelStats.ManaCost > OwnerStats->CurrentMana)
+		return false;
 
 	return true;
 }
@@ -659,110 +736,56 @@ bool UAbility::IsMaxLevel() const
 	return CurrentLevel >= AbilityData->LevelScaling.Num();
 }
 
-float UAbility::GetManaCost() const
-{
-	if (!AbilityData)
-		return 0.0f;
-
-	float Cost = AbilityData->ManaCost;
-
-	// 레벨별 증가
-	if (CurrentLevel > 0 && AbilityData->LevelScaling.IsValidIndex(CurrentLevel - 1))
-	{
-		Cost += AbilityData->LevelScaling[CurrentLevel - 1].ManaCostIncrease;
-	}
-
-	return Cost;
-}
-
-float UAbility::GetCooldown() const
+float UAbility::GetCooldownPercent() const
 {
-	if (!AbilityData)
+	float TotalCooldown = GetCooldown();
+	if (TotalCooldown <= 0.0f)
 		return 0.0f;
 
-	float CD = AbilityData->Cooldown;
-
-	// 레벨별 감소
-	if (CurrentLevel > 0 && AbilityData->LevelScaling.IsValidIndex(CurrentLevel - 1))
-	{
-		CD -= AbilityData->LevelScaling[CurrentLevel - 1].CooldownReduction;
-	}
-
-	return FMath::Max(0.0f, CD);
+	return 1.0f - (GetRemainingCooldown() / TotalCooldown);
 }
 
-float UAbility::GetRange() const
+float UAbility::GetRemainingCooldown() const
 {
-	if (!AbilityData)
+	if (CooldownEndTime <= 0.0 || !CooldownTimeline)
 		return 0.0f;
 
-	float Range = AbilityData->TargetingConfig.Range;
-
-	// 레벨별 증가
-	if (CurrentLevel > 0 && AbilityData->LevelScaling.IsValidIndex(CurrentLevel - 1))
-	{
-		Range += AbilityData->LevelScaling[CurrentLevel - 1].RangeIncrease;
-	}
-
-	return Range;
+	return FMath::Max(0.0f, static_cast<float>(CooldownEndTime - CooldownTimeline->GetTime()));
 }
 
-float UAbility::GetCooldownPercent() const
+bool UAbility::IsOnCooldown() const
 {
-	float TotalCooldown = GetCooldown();
-	if (TotalCooldown <= 0.0f)
-		return 0.0f;
+	// 충전형은 충전이 남아 있으면 시전 가능
+	if (AbilityData && AbilityData->MaxCharges > 1)
+		return CurrentCharges == 0;
 
-	return 1.0f - (RemainingCooldown / TotalCooldown);
-}
-
-void UAbility::UpdateCooldown(float DeltaTime)
-{
-	if (RemainingCooldown > 0.0f)
-	{
-		RemainingCooldown -= DeltaTime;
-
-		// 충전 시스템: 쿨다운 완료 시 충전 회복
-		if (RemainingCooldown <= 0.0f && AbilityData && AbilityData->MaxCharges > 1)
-		{
-			CurrentCharges = FMath::Min(AbilityData->MaxCharges, CurrentCharges + 1);
-
-			// 아직 충전이 최대가 아니면 다음 충전 쿨다운 시작
-			if (CurrentCharges < AbilityData->MaxCharges)
-			{
-				RemainingCooldown = GetCooldown();
-			}
-			else
-			{
-				RemainingCooldown = 0.0f;
-			}
-		}
-		else if (RemainingCooldown <= 0.0f)
-		{
-			RemainingCooldown = 0.0f;
-		}
-	}
+	return GetRemainingCooldown() > 0.0f;
 }
 
 void UAbility::CheckPendingExecution()
 {
+	// 트리거는 한 번 발동하면 Spatial Hash에서 제거됨
+	PendingRangeTrigger = INDEX_NONE;
+
 	if (!bHasPendingExecution || !PendingExecutionTargetData.TargetActor)
 		return;
 
-	// Check if target is now in range
-	float Distance = FVector::Dist(OwningActor->GetActorLocation(), PendingExecutionTargetData.TargetActor->GetActorLocation());
-	float Range = AbilityData->TargetingConfig.Range;
-
-	if (Distance <= Range)
+	// 대기 중에 대상이 풀로 돌아갔거나 타겟 불가가 됐으면 취소 (풀링된 미니언은 파괴되지 않음)
+	AActor* Target = PendingExecutionTargetData.TargetActor;
+	USpatialHashSubsystem* SpatialHash = GetWorld() ? GetWorld()->GetSubsystem<USpatialHashSubsystem>() : nullptr;
+	if (!IsValid(Target) || (SpatialHash && !SpatialHash->IsRegistered(Target)) || !UTeamComponent::IsTargetable(Target))
 	{
-		UE_LOG(LogTemp, Log, TEXT("Now in range (%.1f <= %.1f). Executing ability!"), Distance, Range);
+		CancelPendingExecution();
+		return;
+	}
 
-		// Clear pending state
-		bHasPendingExecution = false;
+	UE_LOG(LogTemp, Log, TEXT("Now in range (%.1f). Executing ability!"), GetRange());
 
-		// Execute the ability
-		Execute(PendingExecutionTargetData);
-	}
+	// Clear pending state
+	bHasPendingExecution = false;
+
+	// Execute the ability
+	Execute(PendingExecutionTargetData);
 }
 
 void UAbility::CancelPendingExecution()
@@ -773,6 +796,20 @@ void UAbility::CancelPendingExecution()
 		bHasPendingExecution = false;
 		PendingExecutionTargetData = FAbilityTargetData();
 	}
+
+	RemovePendingRangeTrigger();
+}
+
+void UAbility::RemovePendingRangeTrigger()
+{
+	if (PendingRangeTrigger == INDEX_NONE)
+		return;
+
+	if (USpatialHashSubsystem* SpatialHash = GetWorld() ? GetWorld()->GetSubsystem<USpatialHashSubsystem>() : nullptr)
+	{
+		SpatialHash->RemoveRangeTrigger(PendingRangeTrigger);
+	}
+	PendingRangeTrigger = INDEX_NONE;
 }
 
 // ============================================
@@ -781,10 +818,12 @@ void UAbility::CancelPendingExecution()
 
 TArray<AActor*> UAbility::GetValidTargetsFromData(const FAbilityTargetData& TargetData)
 {
+	UTargetingStrategy* TargetingStrategy = GetTargetingStrategy();
 	if (!TargetingStrategy)
 		return TArray<AActor*>();
 
 	// TargetingStrategy를 사용하여 유효한 타겟 수집
+	FTargetingStrategyBinding Binding(*TargetingStrategy, OwningActor, GetRange());
 	return TargetingStrategy->GetValidTargets(TargetData);
 }
 
@@ -840,35 +879,16 @@ void UAbility::SpawnProjectile(const FVector& SpawnLocation, const FRotator& Spa
 		return;
 	}
 
-	// Spawn projectile
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = OwningActor;
-	SpawnParams.Instigator = Cast<APawn>(OwningActor);
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AProjectile_Base* Projectile = World->SpawnActor<AProjectile_Base>(
-		AbilityData->DeliveryConfig.ProjectileClass,
-		SpawnLocation,
-		SpawnRotation,
-		SpawnParams
-	);
+	// Spawn projectile, configured with ability data before it launches
+	AProjectile_Base* Projectile = UActorPoolSubsystem::AcquireOrSpawn<AProjectile_Base>(
+		World, AbilityData->DeliveryConfig.ProjectileClass, SpawnLocation, SpawnRotation, OwningActor, Cast<APawn>(OwningActor),
+		[this](AProjectile_Base* NewProjectile)
+		{
+			ConfigureProjectile(NewProjectile, PendingTargetData.TargetActor);
+		});
 
 	if (Projectile)
 	{
-		// Configure projectile with ability data
-		if (Projectile->ProjectileMovement)
-		{
-			Projectile->ProjectileMovement->InitialSpeed = AbilityData->DeliveryConfig.ProjectileSpeed;
-			Projectile->ProjectileMovement->MaxSpeed = AbilityData->DeliveryConfig.ProjectileSpeed;
-
-			if (AbilityData->DeliveryConfig.bIsHoming && PendingTargetData.TargetActor)
-			{
-				Projectile->ProjectileMovement->bIsHomingProjectile = true;
-				Projectile->ProjectileMovement->HomingAccelerationMagnitude = AbilityData->DeliveryConfig.HomingAcceleration;
-				Projectile->ProjectileMovement->HomingTargetComponent = PendingTargetData.TargetActor->GetRootComponent();
-			}
-		}
-
 		UE_LOG(LogTemp, Log, TEXT("Spawned projectile for ability %s at %s"),
 			*AbilityData->AbilityName.ToString(),
 			*SpawnLocation.ToString());
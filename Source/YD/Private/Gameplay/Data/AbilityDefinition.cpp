@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Gameplay/Data/AbilityDefinition.h"
+#include "Gameplay/Data/AbilityData.h"
+#include "Gameplay/Data/AbilityEffect.h"
+#include "Gameplay/Data/TargetingStrategy.h"
+
+void UAbilityDefinition::Compile(UAbilityData* InData)
+{
+	Data = InData;
+	TargetingStrategy = nullptr;
+	Effects.Reset();
+	LevelStats.Reset();
+
+	if (!Data)
+	{
+		LevelStats.AddDefaulted();
+		return;
+	}
+
+	// ============================================
+	// Level Table
+	// ============================================
+
+	FAbilityLevelStats& Base = LevelStats.AddDefaulted_GetRef();
+	Base.ManaCost = Data->ManaCost;
+	Base.Cooldown = FMath::Max(0.0f, Data->Cooldown);
+	Base.Range = Data->TargetingConfig.Range;
+
+	for (const FAbilityLevelData& Scaling : Data->LevelScaling)
+	{
+		FAbilityLevelStats& Stats = LevelStats.AddDefaulted_GetRef();
+		Stats.ManaCost = Data->ManaCost + Scaling.ManaCostIncrease;
+		Stats.Cooldown = FMath::Max(0.0f, Data->Cooldown - Scaling.CooldownReduction);
+		Stats.Range = Data->TargetingConfig.Range + Scaling.RangeIncrease;
+		Stats.DamageMultiplier = Scaling.DamageMultiplier;
+	}
+
+	// ============================================
+	// Targeting Strategy
+	// ============================================
+
+	// 커스텀 전략은 공유하지 않음 (UAbility가 소유자와 함께 생성)
+	if (!Data->CustomTargetingClass)
+	{
+		TargetingStrategy = NewObject<UTargetingStrategy>(this);
+
+		// 소유자 없이 필터만 컴파일 (소유자/사거리는 호출마다 바인딩)
+		TargetingStrategy->Initialize(Data->TargetingConfig, nullptr);
+	}
+
+	// ============================================
+	// Effects
+	// ============================================
+
+	for (int32 i = 0; i < Data->Effects.Num(); i++)
+	{
+		const FAbilityEffectData& EffectData = Data->Effects[i];
+		if (!EffectData.EffectClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AbilityDefinition %s: Effect %d has no EffectClass set!"), *Data->GetName(), i);
+			continue;
+		}
+
+		UAbilityEffect* NewEffect = NewObject<UAbilityEffect>(this, EffectData.EffectClass);
+		NewEffect->InitializeFromData(EffectData);
+		Effects.Add(NewEffect);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("AbilityDefinition compiled for %s (Effects: %d, Levels: %d)"),
+		*Data->GetName(), Effects.Num(), LevelStats.Num() - 1);
+}
@@ -4,43 +4,67 @@
 
 #include "Gameplay/Components/CharacterStatComponent.h"
 #include "Gameplay/Data/Ability.h"
+#include "Gameplay/Characters/Player/YDCharacter.h"
 
-void UAbilityEffect::InitializeFromData(const FAbilityEffectData& InData, UAbility* Ability)
+FEffectInstigatorSnapshot FEffectInstigatorSnapshot::Capture(AActor* Instigator, const UCharacterStatComponent* InstigatorStats, UAbility* SourceAbility, float DamageMultiplier)
 {
-	EffectData = InData;
-	SourceAbility = Ability;
-	Duration = InData.Duration;
-	RemainingDuration = Duration;
+	FEffectInstigatorSnapshot Snapshot;
+	Snapshot.Instigator = Instigator;
+	Snapshot.SourceAbility = SourceAbility;
+	Snapshot.DamageMultiplier = DamageMultiplier;
+
+	if (InstigatorStats)
+	{
+		Snapshot.AttackDamage = InstigatorStats->GetCurrentAttackDamage();
+		Snapshot.AbilityPower = InstigatorStats->GetCurrentAbilityPower();
+	}
+
+	return Snapshot;
 }
 
-void UAbilityEffect::Apply(AActor* Target, AActor* Instigator)
+UCharacterStatComponent* FEffectBatchTarget::ResolveStats(AActor* Actor)
 {
-	// Base implementation - override in subclasses
+	if (!Actor)
+		return nullptr;
+
+	if (const AYDCharacter* Character = Cast<AYDCharacter>(Actor))
+	{
+		return Character->GetCharacterStatComponent();
+	}
+
+	return Actor->FindComponentByClass<UCharacterStatComponent>();
 }
 
-void UAbilityEffect::OnApplied()
+void UAbilityEffect::InitializeFromData(const FAbilityEffectData& InData)
 {
-	// Base implementation - override in subclasses
+	EffectData = InData;
+	Duration = InData.Duration;
 }
 
-void UAbilityEffect::OnRemoved()
+void UAbilityEffect::Apply(AActor* Target, AActor* Instigator)
 {
 	// Base implementation - override in subclasses
 }
 
-void UAbilityEffect::UpdateDuration(float DeltaTime)
+void UAbilityEffect::ApplyBatch(TArrayView<const FEffectBatchTarget> Targets, const FEffectInstigatorSnapshot& Snapshot)
 {
-	if (Duration > 0.0f)
+	for (const FEffectBatchTarget& Target : Targets)
 	{
-		RemainingDuration -= DeltaTime;
+		Apply(Target.Actor, Snapshot.Instigator);
 	}
 }
 
-bool UAbilityEffect::IsExpired() const
+void UAbilityEffect::OnApplied()
+{
+	// Base implementation - override in subclasses
+}
+
+void UAbilityEffect::OnRemoved()
 {
-	return Duration > 0.0f && RemainingDuration <= 0.0f;
+	// Base implementation - override in subclasses
 }
 
+
 float UAbilityEffect::CalculateFinalValue(AActor* Instigator) const
 {
 	if (!Instigator)
@@ -57,3 +81,10 @@ float UAbilityEffect::CalculateFinalValue(AActor* Instigator) const
 
 	return FinalValue;
 }
+
+float UAbilityEffect::CalculateFinalValue(const FEffectInstigatorSnapshot& Snapshot) const
+{
+	return EffectData.BaseValue
+		+ Snapshot.AttackDamage * EffectData.ADScaling
+		+ Snapshot.AbilityPower * EffectData.APScaling;
+}
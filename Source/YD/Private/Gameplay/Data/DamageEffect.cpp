@@ -32,3 +32,25 @@ void UDamageEffect::Apply(AActor* Target, AActor* Instigator)
 	// Call base implementation for VFX/SFX
 	Super::Apply(Target, Instigator);
 }
+
+void UDamageEffect::ApplyBatch(TArrayView<const FEffectBatchTarget> Targets, const FEffectInstigatorSnapshot& Snapshot)
+{
+	if (!Snapshot.Instigator)
+		return;
+
+	// Same instigator stats for the whole batch - one damage value, identical to per-target Apply
+	const float FinalDamage = CalculateFinalValue(Snapshot);
+
+	int32 NumDamaged = 0;
+	for (const FEffectBatchTarget& Target : Targets)
+	{
+		if (!Target.Stats)
+			continue;
+
+		Target.Stats->TakeDamage(FinalDamage, Snapshot.Instigator);
+		NumDamaged++;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("DamageEffect applied %.1f damage from %s to %d/%d targets"),
+		FinalDamage, *Snapshot.Instigator->GetName(), NumDamaged, Targets.Num());
+}
@@ -1,6 +1,11 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Gameplay/Data/TargetingStrategy.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
+#include "Core/Subsystems/LineOfSightSubsystem.h"
+#include "Core/Subsystems/TargetingQueryCacheSubsystem.h"
+#include "Gameplay/Components/TeamComponent.h"
+#include "Core/DistanceKernels.h"
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
 #include "Kismet/GameplayStatics.h"
@@ -9,11 +14,246 @@
 #include "CollisionShape.h"
 #include "Engine/OverlapResult.h"
 #include "WorldCollision.h"
+#include "Algo/Sort.h"
+#include <atomic>
+
+DEFINE_STAT(STAT_TargetingQueries);
+DEFINE_STAT(STAT_TargetingBufferSpills);
+
+namespace TargetingScratchAllocations
+{
+	static std::atomic<int32> HeapAllocationCount{0};
+
+	void NoteHeapAllocation()
+	{
+		HeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	int32 GetHeapAllocationCount()
+	{
+		return HeapAllocationCount.load(std::memory_order_relaxed);
+	}
+}
+
+namespace TargetingStrategyUtil
+{
+	using FPositionBuffer = TSoAPositions<TargetingInlineCapacity, FTargetingHeapAllocator>;
+	using FDistanceBuffer = TArray<float, FTargetingInlineAllocator>;
+	using FIndexBuffer = TArray<int32, FTargetingInlineAllocator>;
+	using FMaskBuffer = TArray<uint8, FTargetingInlineAllocator>;
+
+	/** Targets[FirstIndex..] 위치를 SoA로 모음 - 이후 거리 계산은 SIMD 커널에서 */
+	template<typename AllocatorType>
+	static void GatherPositions(const TArray<AActor*, AllocatorType>& Targets, int32 FirstIndex, FPositionBuffer& OutPositions)
+	{
+		OutPositions.Reset();
+		for (int32 i = FirstIndex; i < Targets.Num(); i++)
+		{
+			OutPositions.Add(Targets[i]->GetActorLocation());
+		}
+	}
+
+	/** 전체 Targets의 거리 제곱을 SIMD 커널로 계산 */
+	template<typename AllocatorType>
+	static void ComputeDistances(const TArray<AActor*, AllocatorType>& Targets, const FVector& ReferencePoint, FDistanceBuffer& OutDistSquared)
+	{
+		FPositionBuffer Positions;
+		GatherPositions(Targets, 0, Positions);
+
+		OutDistSquared.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+		Positions.ComputeDistSquared(FVector3f(ReferencePoint), OutDistSquared.GetData());
+	}
+
+	/** 인덱스 순서대로 Targets 재배치 */
+	template<typename AllocatorType>
+	static void ApplyOrder(TArray<AActor*, AllocatorType>& Targets, const FIndexBuffer& Order)
+	{
+		FTargetingResultArray Reordered;
+		Reordered.Reserve(Order.Num());
+		for (int32 Index : Order)
+		{
+			Reordered.Add(Targets[Index]);
+		}
+
+		Targets.Reset();
+		Targets.Append(Reordered);
+	}
+
+	/** FirstIndex 이후에서 ReferencePoint에 가장 가까운 인덱스 (O(n), SIMD argmin) */
+	template<typename AllocatorType>
+	static int32 FindNearestIndex(const TArray<AActor*, AllocatorType>& Targets, int32 FirstIndex, const FVector& ReferencePoint)
+	{
+		FPositionBuffer Positions;
+		GatherPositions(Targets, FirstIndex, Positions);
+
+		const int32 Nearest = Positions.FindNearest(FVector3f(ReferencePoint));
+		return Nearest != INDEX_NONE ? FirstIndex + Nearest : INDEX_NONE;
+	}
+
+	/** 가까운 K개만 가까운 순으로 남김 - K=1은 선형 최소 탐색, 그 외는 크기 K의 최대 힙 (O(n log K)) */
+	template<typename AllocatorType>
+	static void SelectNearest(TArray<AActor*, AllocatorType>& Targets, const FVector& ReferencePoint, int32 K)
+	{
+		if (K <= 0 || Targets.Num() <= K)
+			return;
+
+		if (K == 1)
+		{
+			AActor* Nearest = Targets[FindNearestIndex(Targets, 0, ReferencePoint)];
+			Targets.SetNum(1, EAllowShrinking::No);
+			Targets[0] = Nearest;
+			return;
+		}
+
+		FDistanceBuffer DistSquared;
+		ComputeDistances(Targets, ReferencePoint, DistSquared);
+
+		FIndexBuffer Selected;
+		Selected.SetNumUninitialized(K);
+		Selected.SetNum(DistanceKernels::SelectKNearest(DistSquared.GetData(), DistSquared.Num(), K, Selected.GetData()), EAllowShrinking::No);
+
+		ApplyOrder(Targets, Selected);
+	}
+
+	/** 부채꼴 판정 - 반각 cos만 한 번 계산, 후보 판정은 SoA 커널 (acos/sqrt 없음, DistanceKernels::ConeMask) */
+	struct FConeTest
+	{
+		FVector3f Origin;
+		FVector3f Direction;
+		float CosHalf;
+
+		FConeTest(const FVector& InOrigin, const FVector& InDirection, float AngleDegrees)
+			: Origin(InOrigin)
+			, Direction(InDirection.GetSafeNormal())
+			, CosHalf(FMath::Cos(FMath::DegreesToRadians(AngleDegrees * 0.5f)))
+		{
+		}
+
+		/** OutInside[i] = Positions[i]가 사거리(MaxDistSquared) 안 부채꼴에 있으면 1 */
+		void Test(const FPositionBuffer& Positions, float MaxDistSquared, FMaskBuffer& OutInside) const
+		{
+			OutInside.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+			Positions.ConeMask(Origin, Direction, CosHalf, MaxDistSquared, OutInside.GetData());
+		}
+	};
+
+	/** 스킬샷 판정에서 고려하는 대상 반경 상한 - 더 큰 대상은 이 값으로 잘라서 판정 (해시 탐색 범위와 일치) */
+	static constexpr float SkillshotMaxTargetRadius = 150.f;
+
+	/**
+	 * 스킬샷 판정 (XY 평면) - 진행 방향 [0, Length], 좌우 HalfWidth를 대상 반경만큼 넓힌 직사각형
+	 * 물리 오버랩처럼 캡슐 반경까지 닿으면 맞은 것으로 처리
+	 */
+	struct FSkillshotTest
+	{
+		FVector2D Start;
+		FVector2D Direction;
+		float Length;
+		float HalfWidth;
+
+		FSkillshotTest(const FVector& InStart, const FVector& InEnd, float Width)
+			: Start(InStart)
+			, HalfWidth(Width * 0.5f)
+		{
+			const FVector2D Delta = FVector2D(InEnd) - Start;
+			Length = Delta.Size();
+			Direction = Length > UE_KINDA_SMALL_NUMBER ? Delta / Length : FVector2D::ZeroVector;
+		}
+
+		/** 넓힌 직사각형을 덮는 중점 기준 반경 (모서리까지 거리) */
+		float GetBoundRadius(float TargetRadius) const
+		{
+			return FMath::Sqrt(FMath::Square(Length * 0.5f + TargetRadius) + FMath::Square(HalfWidth + TargetRadius));
+		}
+
+		bool Contains(const FVector& Position, float TargetRadius) const
+		{
+			const FVector2D ToTarget = FVector2D(Position) - Start;
+
+			// 진행 방향 성분
+			const float Along = FVector2D::DotProduct(ToTarget, Direction);
+			if (Along < -TargetRadius || Along > Length + TargetRadius)
+				return false;
+
+			// 좌우 성분
+			const float Lateral = FVector2D::CrossProduct(Direction, ToTarget);
+			return FMath::Abs(Lateral) <= HalfWidth + TargetRadius;
+		}
+	};
+
+	/**
+	 * 물리 오버랩으로 게임플레이 액터 수집 (오버랩 결과 배열은 힙 할당)
+	 * SpatialHash가 있으면 해시로 이미 수집한 등록 액터는 제외 - 해시에 없는 액터만 추가
+	 */
+	template<typename AllocatorType>
+	static void OverlapGameplayActors(UWorld* World, const FVector& Center, const FQuat& Rotation, const FCollisionShape& Shape,
+		const AActor* IgnoreActor, const USpatialHashSubsystem* SpatialHash, TArray<AActor*, AllocatorType>& OutActors)
+	{
+		TArray<FOverlapResult> Overlaps;
+		FCollisionQueryParams QueryParams;
+		QueryParams.AddIgnoredActor(IgnoreActor);
+
+		World->OverlapMultiByChannel(
+			Overlaps,
+			Center,
+			Rotation,
+			ECC_Pawn,
+			Shape,
+			QueryParams
+		);
+
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			AActor* Actor = Overlap.GetActor();
+
+			// Only collect gameplay actors (team/unit type cached, no tag scan)
+			if (Actor && UTeamComponent::IsTargetable(Actor) && !(SpatialHash && SpatialHash->IsRegistered(Actor)))
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	}
+
+	/** 거리순 정렬 (거리는 액터당 한 번만, SIMD 커널로 계산) */
+	template<typename AllocatorType>
+	static void SortByDistance(TArray<AActor*, AllocatorType>& Targets, const FVector& ReferencePoint)
+	{
+		FDistanceBuffer DistSquared;
+		ComputeDistances(Targets, ReferencePoint, DistSquared);
+
+		FIndexBuffer Order;
+		Order.SetNumUninitialized(Targets.Num());
+		for (int32 i = 0; i < Order.Num(); i++)
+		{
+			Order[i] = i;
+		}
+
+		// 거리 같으면 인덱스로 비교해서 결과가 안정적
+		Algo::Sort(Order, [&DistSquared](int32 A, int32 B)
+		{
+			return DistSquared[A] < DistSquared[B] || (DistSquared[A] == DistSquared[B] && A < B);
+		});
+
+		ApplyOrder(Targets, Order);
+	}
+}
 
 void UTargetingStrategy::Initialize(const FTargetingConfig& IsConfig, AActor* Owner)
 {
 	Config = IsConfig;
 	OwningActor = Owner;
+
+	// 필터 컴파일: 기본 클래스는 마스크 AND 한 번, 서브클래스는 오버라이드된 훅을 존중
+	CompiledFilter.Mask = Config.TargetFilter;
+	CompiledFilter.ObserverTeamId = UTeamComponent::GetTeamId(Owner);
+	bUseFilterHooks = GetClass() != UTargetingStrategy::StaticClass();
+}
+
+FTargetingStrategyBinding::FTargetingStrategyBinding(UTargetingStrategy& Strategy, AActor* Owner, float Range)
+	: OwnerGuard(Strategy.OwningActor, Owner)
+	, RangeGuard(Strategy.Config.Range, Range)
+	, TeamGuard(Strategy.CompiledFilter.ObserverTeamId, UTeamComponent::GetTeamId(Owner))
+{
 }
 
 // ============================================
@@ -25,10 +265,18 @@ TArray<AActor*> UTargetingStrategy::GetValidTargets(const FAbilityTargetData& Ta
 	if (!OwningActor)
 		return TArray<AActor*>();
 
+	// 기본 클래스는 버퍼 경로를 그대로 사용 (결과 복사 한 번)
+	if (!bUseFilterHooks)
+	{
+		FTargetingResultArray Buffer;
+		GetValidTargets(TargetData, Buffer);
+		return TArray<AActor*>(Buffer);
+	}
+
 	// 1. 타겟 타입에 따라 잠재적 타겟들 수집
 	TArray<AActor*> PotentialTargets = CollectPotentialTargets(TargetData);
 
-	// 2. 필터링 및 검증
+	// 2. 필터링 및 검증 (서브클래스 훅 사용)
 	TArray<AActor*> ValidTargets;
 	for (AActor* Target : PotentialTargets)
 	{
@@ -50,15 +298,116 @@ TArray<AActor*> UTargetingStrategy::GetValidTargets(const FAbilityTargetData& Ta
 	return ValidTargets;
 }
 
+void UTargetingStrategy::GetValidTargets(const FAbilityTargetData& TargetData, FTargetingResultArray& OutTargets)
+{
+	OutTargets.Reset();
+
+	if (!OwningActor)
+		return;
+
+	INC_DWORD_STAT(STAT_TargetingQueries);
+
+	// 서브클래스는 오버라이드된 가상 경로 결과를 복사
+	if (bUseFilterHooks)
+	{
+		OutTargets.Append(GetValidTargets(TargetData));
+		return;
+	}
+
+	// 배치당 한 번 관찰자 팀 조회
+	CompiledFilter.ObserverTeamId = UTeamComponent::GetTeamId(OwningActor);
+
+	// 0. 같은 프레임에 같은 모양의 쿼리가 있었으면 결과 재사용
+	UWorld* World = GetWorld();
+	UTargetingQueryCacheSubsystem* QueryCache = World ? World->GetSubsystem<UTargetingQueryCacheSubsystem>() : nullptr;
+
+	FTargetingQueryKey QueryKey;
+	if (QueryCache)
+	{
+		MakeQueryKey(TargetData, QueryKey);
+		if (QueryCache->Find(QueryKey, OutTargets))
+			return;
+	}
+
+	// 1. 타겟 타입에 따라 잠재적 타겟들을 출력 버퍼에 바로 수집
+	CollectTargetsOfType(Config.TargetingType, TargetData, OutTargets);
+
+	// 2. 필터링 및 검증 - 버퍼 안에서 압축 (액터당 한 번 분류, 프레임 메모 사용)
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < OutTargets.Num(); ReadIndex++)
+	{
+		AActor* Target = OutTargets[ReadIndex];
+		if (!Target)
+			continue;
+
+		if (ValidateTargetMemoized(Target))
+		{
+			OutTargets[WriteIndex++] = Target;
+		}
+	}
+	OutTargets.SetNum(WriteIndex, EAllowShrinking::No);
+
+	// 3. MaxTargets 제한 적용
+	if (Config.MaxTargets > 0 && OutTargets.Num() > Config.MaxTargets)
+	{
+		FVector ReferencePoint = TargetData.TargetLocation.IsNearlyZero()
+			? OwningActor->GetActorLocation()
+			: TargetData.TargetLocation;
+		LimitTargetCount(OutTargets, ReferencePoint);
+	}
+
+	// 인라인 용량을 넘겨 힙으로 넘어간 경우 기록
+	if (OutTargets.Max() > TargetingInlineCapacity)
+	{
+		INC_DWORD_STAT(STAT_TargetingBufferSpills);
+	}
+
+	if (QueryCache)
+	{
+		QueryCache->Store(QueryKey, OutTargets);
+	}
+}
+
 bool UTargetingStrategy::ValidateTarget(AActor* Target) const
 {
 	if (!Target || !OwningActor)
 		return false;
 
+	// 기본 클래스는 프레임 메모 사용 (어빌리티가 같은 프레임에 ValidateTarget 후 GetValidTargets 호출)
+	if (!bUseFilterHooks)
+		return ValidateTargetMemoized(Target);
+
 	// 1. 필터 체크
 	if (!PassesFilter(Target))
 		return false;
 
+	return PassesRangeAndSight(Target);
+}
+
+bool UTargetingStrategy::ValidateTargetMemoized(AActor* Target) const
+{
+	// 프레임이 바뀌면 메모 비우기 (버킷은 유지)
+	if (ValidateMemoFrame != GFrameCounter)
+	{
+		ValidateMemoFrame = GFrameCounter;
+		ValidateMemo.Reset();
+	}
+
+	const TPair<TObjectKey<AActor>, TObjectKey<AActor>> MemoKey(OwningActor, Target);
+	if (const bool* Memo = ValidateMemo.Find(MemoKey))
+	{
+		INC_DWORD_STAT(STAT_TargetingValidateMemoHits);
+		return *Memo;
+	}
+
+	const int32 Classification = UTeamComponent::ClassifyTarget(Target, OwningActor, CompiledFilter.ObserverTeamId);
+	const bool bValid = CompiledFilter.Passes(Classification) && PassesRangeAndSight(Target);
+	ValidateMemo.Add(MemoKey, bValid);
+	return bValid;
+}
+
+bool UTargetingStrategy::PassesRangeAndSight(AActor* Target) const
+{
 	// 2. 범위 체크
 	if (!IsInRange(Target))
 		return false;
@@ -73,6 +422,37 @@ bool UTargetingStrategy::ValidateTarget(AActor* Target) const
 	return true;
 }
 
+void UTargetingStrategy::MakeQueryKey(const FAbilityTargetData& TargetData, FTargetingQueryKey& OutKey) const
+{
+	const UTargetingQueryCacheSubsystem* QueryCache = GetWorld()->GetSubsystem<UTargetingQueryCacheSubsystem>();
+	const FTeamInfo OwnerInfo = UTeamComponent::GetTeamInfo(OwningActor);
+
+	OutKey.Origin = QueryCache->QuantizeLocation(OwningActor->GetActorLocation());
+	OutKey.TargetLocation = QueryCache->QuantizeLocation(TargetData.TargetLocation);
+	OutKey.Direction = FIntVector(
+		FMath::RoundToInt(TargetData.Direction.X * 64.0),
+		FMath::RoundToInt(TargetData.Direction.Y * 64.0),
+		FMath::RoundToInt(TargetData.Direction.Z * 64.0));
+	OutKey.TargetActor = TargetData.TargetActor;
+	OutKey.Range = Config.Range;
+	OutKey.Radius = Config.Radius;
+	OutKey.Width = Config.Width;
+	OutKey.Angle = Config.Angle;
+	OutKey.MaxTargets = Config.MaxTargets;
+	OutKey.FilterMask = CompiledFilter.Mask;
+	OutKey.TargetingType = static_cast<uint8>(Config.TargetingType);
+	OutKey.ObserverTeamId = CompiledFilter.ObserverTeamId;
+	OutKey.Flags = (Config.bRequiresLineOfSight ? 1 : 0)
+		| (Config.bCanTargetThroughWalls ? 2 : 0)
+		| (Config.bDeferLineOfSight ? 4 : 0)
+		| (Config.bOverlapUnregisteredActors ? 8 : 0);
+
+	// 필터가 소유자 자신을 통과시킬 수 있으면(Self/Ally/자기 유닛 타입) 결과를 다른 소유자와 공유하지 않음
+	const int32 OwnerMatchMask = static_cast<int32>(ETargetFilter::Self) | static_cast<int32>(ETargetFilter::Ally) | OwnerInfo.UnitTypeMask;
+	const bool bShareable = CompiledFilter.Mask != 0 && (CompiledFilter.Mask & OwnerMatchMask) == 0;
+	OutKey.Owner = bShareable ? nullptr : OwningActor;
+}
+
 bool UTargetingStrategy::ValidateTargetData(const FAbilityTargetData& TargetData) const
 {
 	if (!OwningActor)
@@ -140,118 +520,174 @@ TArray<AActor*> UTargetingStrategy::CollectPotentialTargets(const FAbilityTarget
 	}
 }
 
-TArray<AActor*> UTargetingStrategy::CollectTargets_None()
+void UTargetingStrategy::CollectPotentialTargets(const FAbilityTargetData& TargetData, FTargetingResultArray& OutTargets) const
 {
-	TArray<AActor*> Targets;
+	OutTargets.Reset();
+	CollectTargetsOfType(Config.TargetingType, TargetData, OutTargets);
+}
 
-	// Self 필터가 있으면 자신을 타겟으로
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Self)) != 0)
-	{
-		Targets.Add(OwningActor);
-	}
-	// 아니면 주변 범위 내 타겟 수집
-	else if (Config.Radius > 0.0f)
-	{
-		FVector Origin = OwningActor->GetActorLocation();
-		Targets = GetActorsInSphere(Origin, Config.Radius);
-	}
+// 가상 CollectTargets_* 는 서브클래스 오버라이드 지점으로 유지하고, 수집 로직은 CollectTargetsOfType 한 곳에 둔다
 
-	return Targets;
+TArray<AActor*> UTargetingStrategy::CollectTargets_None()
+{
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::None, FAbilityTargetData(), Buffer);
+	return TArray<AActor*>(Buffer);
 }
 
 TArray<AActor*> UTargetingStrategy::CollectTargets_Unit(const FAbilityTargetData& TargetData)
 {
-	TArray<AActor*> Targets;
-
-	if (TargetData.TargetActor)
-	{
-		Targets.Add(TargetData.TargetActor);
-	}
-
-	return Targets;
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::Unit, TargetData, Buffer);
+	return TArray<AActor*>(Buffer);
 }
 
 TArray<AActor*> UTargetingStrategy::CollectTargets_Ground(const FAbilityTargetData& TargetData)
 {
-	TArray<AActor*> Targets;
-
-	// Ground 타입은 위치만 필요하고 타겟 수집은 안함
-	// (실제 타겟이 필요하면 Radius 설정)
-	if (Config.Radius > 0.0f)
-	{
-		Targets = GetActorsInSphere(TargetData.TargetLocation, Config.Radius);
-	}
-
-	return Targets;
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::Ground, TargetData, Buffer);
+	return TArray<AActor*>(Buffer);
 }
 
 TArray<AActor*> UTargetingStrategy::CollectTargets_Direction(const FAbilityTargetData& TargetData)
 {
-	if (!OwningActor)
-		return TArray<AActor*>();
-
-	FVector Start = OwningActor->GetActorLocation();
-	FVector End = Start + (TargetData.Direction.GetSafeNormal() * Config.Range);
-
-	return GetActorsInBox(Start, End, Config.Width);
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::Direction, TargetData, Buffer);
+	return TArray<AActor*>(Buffer);
 }
 
 TArray<AActor*> UTargetingStrategy::CollectTargets_GroundAOE(const FAbilityTargetData& TargetData)
 {
-	return GetActorsInSphere(TargetData.TargetLocation, Config.Radius);
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::GroundAOE, TargetData, Buffer);
+	return TArray<AActor*>(Buffer);
 }
 
 TArray<AActor*> UTargetingStrategy::CollectTargets_UnitAOE(const FAbilityTargetData& TargetData)
 {
-	FVector Center;
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::UnitAOE, TargetData, Buffer);
+	return TArray<AActor*>(Buffer);
+}
 
-	if (TargetData.TargetActor)
-	{
-		Center = TargetData.TargetActor->GetActorLocation();
-	}
-	else if (!TargetData.TargetLocation.IsNearlyZero())
-	{
-		Center = TargetData.TargetLocation;
-	}
-	else
-	{
-		Center = OwningActor->GetActorLocation();
-	}
+TArray<AActor*> UTargetingStrategy::CollectTargets_Cone(const FAbilityTargetData& TargetData)
+{
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::Cone, TargetData, Buffer);
+	return TArray<AActor*>(Buffer);
+}
 
-	return GetActorsInSphere(Center, Config.Radius);
+TArray<AActor*> UTargetingStrategy::CollectTargets_Auto()
+{
+	FTargetingResultArray Buffer;
+	CollectTargetsOfType(ETargetingType::Auto, FAbilityTargetData(), Buffer);
+	return TArray<AActor*>(Buffer);
 }
 
-TArray<AActor*> UTargetingStrategy::CollectTargets_Cone(const FAbilityTargetData& TargetData)
+void UTargetingStrategy::CollectTargetsOfType(ETargetingType Type, const FAbilityTargetData& TargetData, FTargetingResultArray& OutTargets) const
 {
 	if (!OwningActor)
-		return TArray<AActor*>();
+		return;
 
-	FVector Origin = OwningActor->GetActorLocation();
-	FVector Direction = TargetData.Direction.GetSafeNormal();
+	switch (Type)
+	{
+	case ETargetingType::None:
+		// Self 필터가 있으면 자신을 타겟으로
+		if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Self)) != 0)
+		{
+			OutTargets.Add(OwningActor);
+		}
+		// 아니면 주변 범위 내 타겟 수집
+		else if (Config.Radius > 0.0f)
+		{
+			GetActorsInSphere(OwningActor->GetActorLocation(), Config.Radius, OutTargets);
+		}
+		break;
+
+	case ETargetingType::Unit:
+		if (TargetData.TargetActor)
+		{
+			OutTargets.Add(TargetData.TargetActor);
+		}
+		break;
 
-	if (Direction.IsNearlyZero())
+	case ETargetingType::Ground:
+		// Ground 타입은 위치만 필요하고 타겟 수집은 안함
+		// (실제 타겟이 필요하면 Radius 설정)
+		if (Config.Radius > 0.0f)
+		{
+			GetActorsInSphere(TargetData.TargetLocation, Config.Radius, OutTargets);
+		}
+		break;
+
+	case ETargetingType::Direction:
 	{
-		Direction = OwningActor->GetActorForwardVector();
+		FVector Start = OwningActor->GetActorLocation();
+		FVector End = Start + (TargetData.Direction.GetSafeNormal() * Config.Range);
+		GetActorsInBox(Start, End, Config.Width, OutTargets);
+		break;
 	}
 
-	return GetActorsInCone(Origin, Direction, Config.Range, Config.Angle);
-}
+	case ETargetingType::GroundAOE:
+		GetActorsInSphere(TargetData.TargetLocation, Config.Radius, OutTargets);
+		break;
 
-TArray<AActor*> UTargetingStrategy::CollectTargets_Auto()
-{
-	// 자동 타겟: 범위 내 가장 가까운 적
-	TArray<AActor*> PotentialTargets = GetActorsInSphere(
-		OwningActor->GetActorLocation(),
-		Config.Range
-	);
+	case ETargetingType::UnitAOE:
+	{
+		FVector Center;
 
-	if (PotentialTargets.Num() > 0)
+		if (TargetData.TargetActor)
+		{
+			Center = TargetData.TargetActor->GetActorLocation();
+		}
+		else if (!TargetData.TargetLocation.IsNearlyZero())
+		{
+			Center = TargetData.TargetLocation;
+		}
+		else
+		{
+			Center = OwningActor->GetActorLocation();
+		}
+
+		GetActorsInSphere(Center, Config.Radius, OutTargets);
+		break;
+	}
+
+	case ETargetingType::Cone:
+	{
+		FVector Origin = OwningActor->GetActorLocation();
+		FVector Direction = TargetData.Direction.GetSafeNormal();
+
+		if (Direction.IsNearlyZero())
+		{
+			Direction = OwningActor->GetActorForwardVector();
+		}
+
+		GetActorsInCone(Origin, Direction, Config.Range, Config.Angle, OutTargets);
+		break;
+	}
+
+	case ETargetingType::Auto:
 	{
-		SortByDistance(PotentialTargets, OwningActor->GetActorLocation());
-		return TArray<AActor*>{PotentialTargets[0]};
+		// 자동 타겟: 범위 내 가장 가까운 적
+		const int32 FirstIndex = OutTargets.Num();
+		const FVector Origin = OwningActor->GetActorLocation();
+		GetActorsInSphere(Origin, Config.Range, OutTargets);
+
+		// 한 명만 필요하므로 정렬 없이 선형 최소 탐색
+		const int32 ClosestIndex = TargetingStrategyUtil::FindNearestIndex(OutTargets, FirstIndex, Origin);
+		if (ClosestIndex != INDEX_NONE)
+		{
+			AActor* Closest = OutTargets[ClosestIndex];
+			OutTargets.SetNum(FirstIndex + 1, EAllowShrinking::No);
+			OutTargets[FirstIndex] = Closest;
+		}
+		break;
 	}
 
-	return TArray<AActor*>();
+	default:
+		break;
+	}
 }
 
 // ============================================
@@ -263,55 +699,33 @@ bool UTargetingStrategy::PassesFilter(AActor* Target) const
 	if (!Target)
 		return false;
 
+	if (bUseFilterHooks)
+		return PassesFilterWithHooks(Target);
+
 	// 필터가 없으면 통과
-	if (Config.TargetFilter == 0)
+	if (CompiledFilter.Mask == 0)
 		return true;
 
-	bool bPasses = false;
-
-	// Ally 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Ally)) != 0)
-	{
-		bPasses |= IsAlly(Target);
-	}
-
-	// Enemy 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Enemy)) != 0)
-	{
-		bPasses |= IsEnemy(Target);
-	}
-
-	// Self 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Self)) != 0)
-	{
-		bPasses |= IsSelf(Target);
-	}
-
-	// Minion 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Minion)) != 0)
-	{
-		bPasses |= IsMinion(Target);
-	}
-
-	// Champion 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Champion)) != 0)
-	{
-		bPasses |= IsChampion(Target);
-	}
+	// 관계(Ally/Enemy/Self)와 유닛 타입 비트를 한 번에 계산해서 필터와 AND
+	return CompiledFilter.Passes(UTeamComponent::ClassifyTarget(Target, OwningActor));
+}
 
-	// Structure 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Structure)) != 0)
-	{
-		bPasses |= IsStructure(Target);
-	}
+bool UTargetingStrategy::PassesFilterWithHooks(AActor* Target) const
+{
+	// 필터가 없으면 통과
+	if (Config.TargetFilter == 0)
+		return true;
 
-	// Neutral 필터
-	if ((Config.TargetFilter & static_cast<int32>(ETargetFilter::Neutral)) != 0)
-	{
-		bPasses |= IsNeutral(Target);
-	}
+	const int32 Filter = Config.TargetFilter;
 
-	return bPasses;
+	// 비트별로 오버라이드 가능한 훅 호출 (하나라도 통과하면 true)
+	return ((Filter & static_cast<int32>(ETargetFilter::Ally)) != 0 && IsAlly(Target))
+		|| ((Filter & static_cast<int32>(ETargetFilter::Enemy)) != 0 && IsEnemy(Target))
+		|| ((Filter & static_cast<int32>(ETargetFilter::Self)) != 0 && IsSelf(Target))
+		|| ((Filter & static_cast<int32>(ETargetFilter::Minion)) != 0 && IsMinion(Target))
+		|| ((Filter & static_cast<int32>(ETargetFilter::Champion)) != 0 && IsChampion(Target))
+		|| ((Filter & static_cast<int32>(ETargetFilter::Structure)) != 0 && IsStructure(Target))
+		|| ((Filter & static_cast<int32>(ETargetFilter::Neutral)) != 0 && IsNeutral(Target));
 }
 
 bool UTargetingStrategy::IsInRange(AActor* Target) const
@@ -335,6 +749,18 @@ bool UTargetingStrategy::HasLineOfSight(AActor* Target) const
 	if (!World)
 		return false;
 
+	// 시야 서비스: 셀 쌍 단위 캐시 + 비동기 트레이스
+	if (ULineOfSightSubsystem* LineOfSight = World->GetSubsystem<ULineOfSightSubsystem>())
+	{
+		if (Config.bDeferLineOfSight)
+		{
+			// 결과 대기 중(Pending)이면 이번 쿼리에서는 보이지 않는 것으로 처리
+			return LineOfSight->QueryLineOfSight(OwningActor, Target) == ELineOfSightResult::Visible;
+		}
+
+		return LineOfSight->HasLineOfSightSync(OwningActor, Target);
+	}
+
 	FVector Start = OwningActor->GetActorLocation();
 	FVector End = Target->GetActorLocation();
 
@@ -357,40 +783,20 @@ bool UTargetingStrategy::HasLineOfSight(AActor* Target) const
 
 bool UTargetingStrategy::IsAlly(AActor* Target) const
 {
-	// TODO: Team Component나 Interface로 팀 정보 가져오기
 	if (!Target || !OwningActor)
 		return false;
 
-	// 자신이면 아군
-	if (Target == OwningActor)
-		return true;
-
-	// 같은 태그를 가진 액터들끼리는 아군 (Enemy끼리, Player끼리)
-	// Enemy 태그가 있으면 Enemy 팀
-	bool bOwnerIsEnemy = OwningActor->Tags.Contains(FName("Enemy"));
-	bool bTargetIsEnemy = Target->Tags.Contains(FName("Enemy"));
-
-	if (bOwnerIsEnemy && bTargetIsEnemy)
-		return true; // Enemy끼리는 아군
-
-	// Player/Champion 태그가 있으면 Player 팀
-	bool bOwnerIsPlayer = OwningActor->Tags.Contains(FName("Player")) || OwningActor->Tags.Contains(FName("Champion"));
-	bool bTargetIsPlayer = Target->Tags.Contains(FName("Player")) || Target->Tags.Contains(FName("Champion"));
-
-	if (bOwnerIsPlayer && bTargetIsPlayer)
-		return true; // Player끼리는 아군
-
-	return false;
+	// 자신이거나 같은 팀이면 아군
+	return UTeamComponent::AreAllies(Target, OwningActor);
 }
 
 bool UTargetingStrategy::IsEnemy(AActor* Target) const
 {
-	// TODO: Team Component나 Interface로 팀 정보 가져오기
 	if (!Target || !OwningActor)
 		return false;
 
 	// 아군이 아니고 자신이 아니면 적
-	return !IsAlly(Target) && !IsSelf(Target);
+	return UTeamComponent::AreEnemies(Target, OwningActor);
 }
 
 bool UTargetingStrategy::IsSelf(AActor* Target) const
@@ -400,27 +806,22 @@ bool UTargetingStrategy::IsSelf(AActor* Target) const
 
 bool UTargetingStrategy::IsMinion(AActor* Target) const
 {
-	// TODO: Actor의 타입을 확인하는 로직 구현
-	// Interface나 Tag, Class 체크 등
-	return Target && Target->Tags.Contains("Minion");
+	return (UTeamComponent::GetTeamInfo(Target).UnitTypeMask & static_cast<int32>(ETargetFilter::Minion)) != 0;
 }
 
 bool UTargetingStrategy::IsChampion(AActor* Target) const
 {
-	// TODO: Actor의 타입을 확인하는 로직 구현
-	return Target && Target->Tags.Contains("Champion");
+	return (UTeamComponent::GetTeamInfo(Target).UnitTypeMask & static_cast<int32>(ETargetFilter::Champion)) != 0;
 }
 
 bool UTargetingStrategy::IsStructure(AActor* Target) const
 {
-	// TODO: Actor의 타입을 확인하는 로직 구현
-	return Target && Target->Tags.Contains("Structure");
+	return (UTeamComponent::GetTeamInfo(Target).UnitTypeMask & static_cast<int32>(ETargetFilter::Structure)) != 0;
 }
 
 bool UTargetingStrategy::IsNeutral(AActor* Target) const
 {
-	// TODO: Actor의 타입을 확인하는 로직 구현
-	return Target && Target->Tags.Contains("Neutral");
+	return (UTeamComponent::GetTeamInfo(Target).UnitTypeMask & static_cast<int32>(ETargetFilter::Neutral)) != 0;
 }
 
 // ============================================
@@ -429,163 +830,190 @@ bool UTargetingStrategy::IsNeutral(AActor* Target) const
 
 TArray<AActor*> UTargetingStrategy::GetActorsInSphere(const FVector& Center, float Radius) const
 {
-	TArray<AActor*> FoundActors;
+	FTargetingResultArray Buffer;
+	GetActorsInSphere(Center, Radius, Buffer);
+	return TArray<AActor*>(Buffer);
+}
 
+void UTargetingStrategy::GetActorsInSphere(const FVector& Center, float Radius, FTargetingResultArray& OutActors) const
+{
 	UWorld* World = GetWorld();
 	if (!World)
-		return FoundActors;
+		return;
 
-	// OverlapMulti로 구체 범위 내 액터 수집
-	TArray<FOverlapResult> Overlaps;
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwningActor);
+	USpatialHashSubsystem* SpatialHash = World->GetSubsystem<USpatialHashSubsystem>();
 
-	World->OverlapMultiByChannel(
-		Overlaps,
-		Center,
-		FQuat::Identity,
-		ECC_Pawn,
-		Sphere,
-		QueryParams
-	);
-
-	for (const FOverlapResult& Overlap : Overlaps)
+	// 등록된 게임플레이 액터는 Spatial Hash로 수집 (물리 오버랩, 중간 배열 없음)
+	if (SpatialHash)
 	{
-		AActor* Actor = Overlap.GetActor();
-		if (Actor)
+		SpatialHash->ForEachEntryInRadius(Center, Radius, [this, SpatialHash, &OutActors](int32 EntryIndex, float DistSquared)
 		{
-			// Only collect actors with gameplay-relevant tags
-			// Ignore terrain/background objects without tags
-			bool bHasGameplayTag = Actor->Tags.Contains(FName("Enemy")) ||
-			                       Actor->Tags.Contains(FName("Structure")) ||
-			                       Actor->Tags.Contains(FName("Character")) ||
-			                       Actor->Tags.Contains(FName("Minion")) ||
-			                       Actor->Tags.Contains(FName("Champion")) ||
-			                       Actor->Tags.Contains(FName("Neutral")) ||
-			                       Actor->Tags.Contains(FName("Player"));
-
-			if (bHasGameplayTag)
+			AActor* Actor = SpatialHash->GetEntryActor(EntryIndex);
+
+			// Only collect gameplay actors (team/unit type cached, no tag scan)
+			if (Actor && Actor != OwningActor && UTeamComponent::IsTargetable(Actor))
 			{
-				FoundActors.Add(Actor);
+				OutActors.Add(Actor);
 			}
-		}
+		});
+
+		// 해시에 없는 액터(TeamComponent 없이 태그만 단 구조물 등)가 필요한 스킬만 물리 오버랩 추가
+		if (!Config.bOverlapUnregisteredActors)
+			return;
 	}
 
-	return FoundActors;
+	// Fallback: OverlapMulti로 구체 범위 내 액터 수집
+	TargetingStrategyUtil::OverlapGameplayActors(World, Center, FQuat::Identity, FCollisionShape::MakeSphere(Radius), OwningActor, SpatialHash, OutActors);
 }
 
 TArray<AActor*> UTargetingStrategy::GetActorsInBox(const FVector& Start, const FVector& End, float Width) const
 {
-	TArray<AActor*> FoundActors;
+	FTargetingResultArray Buffer;
+	GetActorsInBox(Start, End, Width, Buffer);
+	return TArray<AActor*>(Buffer);
+}
 
+void UTargetingStrategy::GetActorsInBox(const FVector& Start, const FVector& End, float Width, FTargetingResultArray& OutActors) const
+{
 	UWorld* World = GetWorld();
 	if (!World)
-		return FoundActors;
+		return;
 
 	FVector Direction = (End - Start).GetSafeNormal();
 	float Length = FVector::Dist(Start, End);
 	FVector Center = Start + Direction * (Length * 0.5f);
 
-	// 박스 크기 계산
-	FVector HalfExtent = FVector(Width * 0.5f, Width * 0.5f, Length * 0.5f);
-	FRotator Rotation = Direction.Rotation();
+	USpatialHashSubsystem* SpatialHash = World->GetSubsystem<USpatialHashSubsystem>();
 
-	TArray<FOverlapResult> Overlaps;
-	FCollisionShape Box = FCollisionShape::MakeBox(HalfExtent);
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwningActor);
+	// 등록된 게임플레이 액터는 Spatial Hash + 스킬샷 판정으로 수집 (물리 오버랩 없음)
+	if (SpatialHash)
+	{
+		using TargetingStrategyUtil::SkillshotMaxTargetRadius;
 
-	World->OverlapMultiByChannel(
-		Overlaps,
-		Center,
-		Rotation.Quaternion(),
-		ECC_Pawn,
-		Box,
-		QueryParams
-	);
+		const TargetingStrategyUtil::FSkillshotTest Skillshot(Start, End, Width);
+		const float BoundRadius = Skillshot.GetBoundRadius(SkillshotMaxTargetRadius);
 
-	for (const FOverlapResult& Overlap : Overlaps)
-	{
-		AActor* Actor = Overlap.GetActor();
-		if (Actor)
+		// 판정이 XY 평면이므로 셀 후보만 받고 (높이 무관) 거리 대신 스킬샷 판정으로 거름
+		SpatialHash->ForEachEntryNear(Center, BoundRadius, [this, SpatialHash, &Skillshot, &OutActors](int32 EntryIndex)
 		{
-			// Only collect actors with gameplay-relevant tags
-			// Ignore terrain/background objects without tags
-			bool bHasGameplayTag = Actor->Tags.Contains(FName("Enemy")) ||
-			                       Actor->Tags.Contains(FName("Structure")) ||
-			                       Actor->Tags.Contains(FName("Character")) ||
-			                       Actor->Tags.Contains(FName("Minion")) ||
-			                       Actor->Tags.Contains(FName("Champion")) ||
-			                       Actor->Tags.Contains(FName("Neutral")) ||
-			                       Actor->Tags.Contains(FName("Player"));
-
-			if (bHasGameplayTag)
+			AActor* Actor = SpatialHash->GetEntryActor(EntryIndex);
+			if (!Actor || Actor == OwningActor || !UTeamComponent::IsTargetable(Actor))
+				return;
+
+			const float TargetRadius = FMath::Min(Actor->GetSimpleCollisionRadius(), SkillshotMaxTargetRadius);
+			if (Skillshot.Contains(SpatialHash->GetEntryLocation(EntryIndex), TargetRadius))
 			{
-				FoundActors.Add(Actor);
+				OutActors.Add(Actor);
 			}
-		}
+		});
+
+		// 해시에 없는 액터(TeamComponent 없이 태그만 단 구조물 등)가 필요한 스킬만 물리 오버랩 추가
+		if (!Config.bOverlapUnregisteredActors)
+			return;
 	}
 
-	return FoundActors;
+	// 박스 크기 계산 (X축 = 진행 방향)
+	FVector HalfExtent = FVector(Length * 0.5f, Width * 0.5f, Width * 0.5f);
+	FRotator Rotation = Direction.Rotation();
+
+	TargetingStrategyUtil::OverlapGameplayActors(World, Center, Rotation.Quaternion(), FCollisionShape::MakeBox(HalfExtent), OwningActor, SpatialHash, OutActors);
 }
 
 TArray<AActor*> UTargetingStrategy::GetActorsInCone(const FVector& Origin, const FVector& Direction, float Range, float AngleDegrees) const
 {
-	TArray<AActor*> FoundActors;
+	FTargetingResultArray Buffer;
+	GetActorsInCone(Origin, Direction, Range, AngleDegrees, Buffer);
+	return TArray<AActor*>(Buffer);
+}
 
-	// 먼저 구체 범위로 수집
-	TArray<AActor*> PotentialTargets = GetActorsInSphere(Origin, Range);
+void UTargetingStrategy::GetActorsInCone(const FVector& Origin, const FVector& Direction, float Range, float AngleDegrees, FTargetingResultArray& OutActors) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
 
-	// 부채꼴 각도로 필터링
-	float HalfAngleRad = FMath::DegreesToRadians(AngleDegrees * 0.5f);
-	FVector NormalizedDirection = Direction.GetSafeNormal();
+	const TargetingStrategyUtil::FConeTest Cone(Origin, Direction, AngleDegrees);
+	USpatialHashSubsystem* SpatialHash = World->GetSubsystem<USpatialHashSubsystem>();
+	int32 FirstIndex = OutActors.Num();
 
-	for (AActor* Actor : PotentialTargets)
+	TargetingStrategyUtil::FPositionBuffer Positions;
+	TargetingStrategyUtil::FMaskBuffer Inside;
+
+	// 구체 안 해시 엔트리 위치를 SoA로 모은 뒤 부채꼴 판정은 SIMD 커널 한 번 (액터 배열 없음)
+	if (SpatialHash)
 	{
-		FVector ToTarget = (Actor->GetActorLocation() - Origin).GetSafeNormal();
-		float DotProduct = FVector::DotProduct(NormalizedDirection, ToTarget);
-		float Angle = FMath::Acos(DotProduct);
+		TargetingStrategyUtil::FIndexBuffer Entries;
+		SpatialHash->ForEachEntryInRadius(Origin, Range, [SpatialHash, &Positions, &Entries](int32 EntryIndex, float DistSquared)
+		{
+			Positions.Add(SpatialHash->GetEntryLocation(EntryIndex));
+			Entries.Add(EntryIndex);
+		});
 
-		if (Angle <= HalfAngleRad)
+		Cone.Test(Positions, Range * Range, Inside);
+
+		for (int32 i = 0; i < Entries.Num(); i++)
 		{
-			FoundActors.Add(Actor);
+			if (!Inside[i])
+				continue;
+
+			AActor* Actor = SpatialHash->GetEntryActor(Entries[i]);
+			if (Actor && Actor != OwningActor && UTeamComponent::IsTargetable(Actor))
+			{
+				OutActors.Add(Actor);
+			}
 		}
+
+		if (!Config.bOverlapUnregisteredActors)
+			return;
+
+		FirstIndex = OutActors.Num();
 	}
 
-	return FoundActors;
+	// Fallback (해시 없음 또는 미등록 액터): 구체 오버랩으로 수집한 뒤 버퍼 안에서 압축
+	TargetingStrategyUtil::OverlapGameplayActors(World, Origin, FQuat::Identity, FCollisionShape::MakeSphere(Range), OwningActor, SpatialHash, OutActors);
+
+	TargetingStrategyUtil::GatherPositions(OutActors, FirstIndex, Positions);
+	Cone.Test(Positions, TNumericLimits<float>::Max(), Inside);
+
+	int32 WriteIndex = FirstIndex;
+	for (int32 ReadIndex = FirstIndex; ReadIndex < OutActors.Num(); ReadIndex++)
+	{
+		if (Inside[ReadIndex - FirstIndex])
+		{
+			OutActors[WriteIndex++] = OutActors[ReadIndex];
+		}
+	}
+	OutActors.SetNum(WriteIndex, EAllowShrinking::No);
 }
 
 // ============================================
 // Utility
 // ============================================
 
-TArray<AActor*> UTargetingStrategy::LimitTargetCount(TArray<AActor*> Targets, const FVector& ReferencePoint) const
+TArray<AActor*> UTargetingStrategy::LimitTargetCount(const TArray<AActor*>& Targets, const FVector& ReferencePoint) const
 {
-	if (Targets.Num() <= Config.MaxTargets)
-		return Targets;
-
-	// 거리순 정렬
-	SortByDistance(Targets, ReferencePoint);
+	FTargetingResultArray Buffer(Targets);
+	LimitTargetCount(Buffer, ReferencePoint);
+	return TArray<AActor*>(Buffer);
+}
 
-	// MaxTargets만큼만 반환
-	TArray<AActor*> LimitedTargets;
-	for (int32 i = 0; i < Config.MaxTargets && i < Targets.Num(); i++)
-	{
-		LimitedTargets.Add(Targets[i]);
-	}
+void UTargetingStrategy::LimitTargetCount(FTargetingResultArray& Targets, const FVector& ReferencePoint) const
+{
+	if (Targets.Num() <= Config.MaxTargets)
+		return;
 
-	return LimitedTargets;
+	// 전체 정렬 대신 가까운 MaxTargets개만 선택 (제자리)
+	TargetingStrategyUtil::SelectNearest(Targets, ReferencePoint, Config.MaxTargets);
 }
 
 void UTargetingStrategy::SortByDistance(TArray<AActor*>& Targets, const FVector& ReferencePoint) const
 {
-	Targets.Sort([ReferencePoint](const AActor& A, const AActor& B)
-	{
-		float DistA = FVector::DistSquared(A.GetActorLocation(), ReferencePoint);
-		float DistB = FVector::DistSquared(B.GetActorLocation(), ReferencePoint);
-		return DistA < DistB;
-	});
+	TargetingStrategyUtil::SortByDistance(Targets, ReferencePoint);
+}
+
+void UTargetingStrategy::SortByDistance(FTargetingResultArray& Targets, const FVector& ReferencePoint) const
+{
+	TargetingStrategyUtil::SortByDistance(Targets, ReferencePoint);
 }
 
 UWorld* UTargetingStrategy::GetWorld() const
@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/DistanceKernels.h"
+#include "HAL/PlatformTime.h"
+
+// ============================================
+// Scalar vs SIMD distance and cone kernel micro-benchmark
+// Automation: YD.Perf.DistanceKernels
+// ============================================
+
+namespace DistanceKernelsBenchmark
+{
+	/** Old pattern: FVector::Dist per pair (double math + sqrt) */
+	static int32 RunFVectorDist(const FVector& Origin, const TArray<FVector>& Positions)
+	{
+		int32 BestIndex = INDEX_NONE;
+		double BestDistance = TNumericLimits<double>::Max();
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			const double Distance = FVector::Dist(Origin, Positions[i]);
+			if (Distance < BestDistance)
+			{
+				BestDistance = Distance;
+				BestIndex = i;
+			}
+		}
+		return BestIndex;
+	}
+
+	static constexpr int32 DefaultIterations = 2000;
+
+	static void RunSize(FAutomationTestBase& Test, int32 Count, int32 Iterations, FRandomStream& Random)
+	{
+		TArray<FVector> Positions;
+		TArray<float> X, Y, Z, DistSquared;
+		TArray<uint8> ConeInside, ConeInsideScalar;
+		Positions.Reserve(Count);
+		for (int32 i = 0; i < Count; i++)
+		{
+			const FVector Position(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(0.f, 200.f));
+			Positions.Add(Position);
+			X.Add(static_cast<float>(Position.X));
+			Y.Add(static_cast<float>(Position.Y));
+			Z.Add(static_cast<float>(Position.Z));
+		}
+		DistSquared.SetNumUninitialized(Count);
+		ConeInside.SetNumUninitialized(Count);
+		ConeInsideScalar.SetNumUninitialized(Count);
+
+		const FVector Origin(Random.FRandRange(-1000.f, 1000.f), Random.FRandRange(-1000.f, 1000.f), 100.f);
+		const FVector3f Origin3f(Origin);
+
+		// Keep results alive so the loops aren't optimized away
+		int64 Checksum = 0;
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Checksum += RunFVectorDist(Origin, Positions);
+		}
+		const double FVectorMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Checksum += DistanceKernels::FindNearestScalar(Origin3f, X.GetData(), Y.GetData(), Z.GetData(), Count);
+		}
+		const double ScalarMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Checksum += DistanceKernels::FindNearest(Origin3f, X.GetData(), Y.GetData(), Z.GetData(), Count);
+		}
+		const double VectorMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			DistanceKernels::ComputeDistSquaredScalar(Origin3f, X.GetData(), Y.GetData(), Z.GetData(), Count, DistSquared.GetData());
+			Checksum += static_cast<int64>(DistSquared[Iteration % Count]);
+		}
+		const double ScalarDistMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			DistanceKernels::ComputeDistSquared(Origin3f, X.GetData(), Y.GetData(), Z.GetData(), Count, DistSquared.GetData());
+			Checksum += static_cast<int64>(DistSquared[Iteration % Count]);
+		}
+		const double VectorDistMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// 90 degree cone facing +X, 3000 range
+		const FVector3f ConeDirection(1.f, 0.f, 0.f);
+		const float ConeCosHalf = FMath::Cos(FMath::DegreesToRadians(45.f));
+		const float ConeRangeSquared = 3000.f * 3000.f;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Checksum += DistanceKernels::ConeMaskScalar(Origin3f, ConeDirection, ConeCosHalf, ConeRangeSquared, X.GetData(), Y.GetData(), Z.GetData(), Count, ConeInsideScalar.GetData());
+		}
+		const double ScalarConeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Checksum += DistanceKernels::ConeMask(Origin3f, ConeDirection, ConeCosHalf, ConeRangeSquared, X.GetData(), Y.GetData(), Z.GetData(), Count, ConeInside.GetData());
+		}
+		const double VectorConeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// All three argmin paths must agree
+		const int32 Expected = DistanceKernels::FindNearestScalar(Origin3f, X.GetData(), Y.GetData(), Z.GetData(), Count);
+		const bool bMatch = RunFVectorDist(Origin, Positions) == Expected
+			&& DistanceKernels::FindNearest(Origin3f, X.GetData(), Y.GetData(), Z.GetData(), Count) == Expected;
+
+		Test.AddInfo(FString::Printf(TEXT("  %6d candidates: argmin FVector::Dist %.3f ms | scalar %.3f ms | SIMD %.3f ms (%.1fx)  dist^2 scalar %.3f ms | SIMD %.3f ms (%.1fx)  [%lld]"),
+			Count, FVectorMs, ScalarMs, VectorMs, ScalarMs / FMath::Max(VectorMs, 1e-6),
+			ScalarDistMs, VectorDistMs, ScalarDistMs / FMath::Max(VectorDistMs, 1e-6), Checksum));
+		Test.AddInfo(FString::Printf(TEXT("  %6d candidates: cone scalar %.3f ms | SIMD %.3f ms (%.1fx)"),
+			Count, ScalarConeMs, VectorConeMs, ScalarConeMs / FMath::Max(VectorConeMs, 1e-6)));
+
+		Test.TestTrue(FString::Printf(TEXT("Argmin paths agree at %d candidates"), Count), bMatch);
+		Test.TestTrue(FString::Printf(TEXT("Cone masks agree at %d candidates"), Count), ConeInside == ConeInsideScalar);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDistanceKernelsBenchmarkTest, "YD.Perf.DistanceKernels",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FDistanceKernelsBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace DistanceKernelsBenchmark;
+
+	FRandomStream Random(1337);
+
+	AddInfo(FString::Printf(TEXT("DistanceKernels benchmark (%d iterations per size)"), DefaultIterations));
+	RunSize(*this, 100, DefaultIterations, Random);
+	RunSize(*this, 1000, DefaultIterations, Random);
+	RunSize(*this, 10000, DefaultIterations / 10, Random);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
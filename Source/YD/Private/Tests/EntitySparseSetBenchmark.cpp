@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/EntitySparseSet.h"
+#include "HAL/PlatformTime.h"
+
+// ============================================
+// Register/unregister micro-benchmark
+// Automation: YD.Perf.EntityRegistry
+// ============================================
+
+namespace EntitySparseSetBenchmark
+{
+	static constexpr int32 Count = 10000;
+
+	/** Old pattern (the baseline registry): TArray Contains on register, TArray::Remove (linear search + shift) on unregister */
+	static int32 RunArray(const TArray<int32>& Keys, const TArray<int32>& RemoveOrder, double& OutAddMs, double& OutRemoveMs)
+	{
+		TArray<int32> Registered;
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Key : Keys)
+		{
+			if (!Registered.Contains(Key))
+			{
+				Registered.Add(Key);
+			}
+		}
+		OutAddMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Key : RemoveOrder)
+		{
+			Registered.Remove(Key);
+		}
+		OutRemoveMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		return Registered.Num();
+	}
+
+	/** New pattern: sparse set lookup, swap-remove of the parallel column at the returned index */
+	static int32 RunSparseSet(const TArray<int32>& Keys, const TArray<int32>& RemoveOrder, double& OutAddMs, double& OutRemoveMs)
+	{
+		TEntitySparseSet<int32> Registered;
+		TArray<float> Column;
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Key : Keys)
+		{
+			if (!Registered.Contains(Key))
+			{
+				Registered.Add(Key);
+				Column.Add(0.f);
+			}
+		}
+		OutAddMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Key : RemoveOrder)
+		{
+			const int32 Row = Registered.Remove(Key);
+			if (Row != INDEX_NONE)
+			{
+				Column.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+			}
+		}
+		OutRemoveMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		return Registered.Num() + Column.Num();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEntityRegistryBenchmarkTest, "YD.Perf.EntityRegistry",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FEntityRegistryBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace EntitySparseSetBenchmark;
+
+	TArray<int32> Keys;
+	Keys.Reserve(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		Keys.Add(i * 7919); // Spread keys like object addresses would be
+	}
+
+	// Deaths don't happen in spawn order
+	TArray<int32> RemoveOrder = Keys;
+	FRandomStream Random(1337);
+	for (int32 i = RemoveOrder.Num() - 1; i > 0; --i)
+	{
+		RemoveOrder.Swap(i, Random.RandRange(0, i));
+	}
+
+	double ArrayAddMs, ArrayRemoveMs, SparseAddMs, SparseRemoveMs;
+	const int32 ArrayLeft = RunArray(Keys, RemoveOrder, ArrayAddMs, ArrayRemoveMs);
+	const int32 SparseLeft = RunSparseSet(Keys, RemoveOrder, SparseAddMs, SparseRemoveMs);
+
+	AddInfo(FString::Printf(TEXT("EntityRegistry benchmark (%d entities)"), Count));
+	AddInfo(FString::Printf(TEXT("  TArray:    register %.3f ms, unregister %.3f ms"), ArrayAddMs, ArrayRemoveMs));
+	AddInfo(FString::Printf(TEXT("  SparseSet: register %.3f ms, unregister %.3f ms"), SparseAddMs, SparseRemoveMs));
+
+	TestEqual(TEXT("TArray entries left after unregistering all"), ArrayLeft, 0);
+	TestEqual(TEXT("Sparse set entries and column rows left after unregistering all"), SparseLeft, 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,118 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Gameplay/Data/TargetingStrategy.h"
+#include "Core/Subsystems/SpatialHashSubsystem.h"
+#include "Core/Subsystems/TargetingQueryCacheSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/TargetPoint.h"
+#include "UObject/Package.h"
+
+// ============================================
+// Heap allocation check for buffered targeting queries
+// Automation: YD.Targeting.BufferedQueryNoAlloc
+// ============================================
+
+namespace TargetingAllocationTest
+{
+	static constexpr int32 Iterations = 1000;
+	static constexpr int32 NumEnemies = 8;
+	static constexpr float Radius = 1500.f;
+
+	/** Tagged actor registered with the spatial hash (team and unit type come from the tags) */
+	static AActor* SpawnUnit(UWorld* World, USpatialHashSubsystem* SpatialHash, const FVector& Location, std::initializer_list<FName> Tags)
+	{
+		ATargetPoint* Unit = World->SpawnActor<ATargetPoint>(Location, FRotator::ZeroRotator);
+		if (Unit)
+		{
+			Unit->Tags.Append(Tags);
+			SpatialHash->RegisterActor(Unit);
+		}
+		return Unit;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTargetingBufferedQueryNoAllocTest, "YD.Targeting.BufferedQueryNoAlloc",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTargetingBufferedQueryNoAllocTest::RunTest(const FString& Parameters)
+{
+	using namespace TargetingAllocationTest;
+
+	// Own world and units, so the result doesn't depend on the loaded map
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TargetingAllocationTest"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	USpatialHashSubsystem* SpatialHash = World->GetSubsystem<USpatialHashSubsystem>();
+	if (!TestNotNull(TEXT("Spatial hash subsystem"), SpatialHash))
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	AActor* Owner = SpawnUnit(World, SpatialHash, FVector::ZeroVector, { FName("Player"), FName("Champion") });
+	for (int32 i = 0; i < NumEnemies; i++)
+	{
+		// Rings at 300/600/900 so MaxTargets has to pick the nearest
+		const FVector Location = FRotator(0.f, 360.f * i / NumEnemies, 0.f).Vector() * (300.f * (1 + i % 3));
+		SpawnUnit(World, SpatialHash, Location, { FName("Enemy"), FName("Minion") });
+	}
+
+	FTargetingConfig Config;
+	Config.TargetingType = ETargetingType::GroundAOE;
+	Config.TargetFilter = static_cast<int32>(ETargetFilter::Enemy) | static_cast<int32>(ETargetFilter::Minion);
+	Config.Radius = Radius;
+	Config.bRequiresLineOfSight = false;
+	Config.MaxTargets = 5;
+
+	// Measure the query itself - a cache hit would skip collection, filtering and selection
+	if (UTargetingQueryCacheSubsystem* QueryCache = World->GetSubsystem<UTargetingQueryCacheSubsystem>())
+	{
+		QueryCache->bEnabled = false;
+	}
+
+	UTargetingStrategy* Strategy = NewObject<UTargetingStrategy>(GetTransientPackage());
+	Strategy->Initialize(Config, Owner);
+
+	FAbilityTargetData TargetData;
+	TargetData.bIsValid = true;
+	TargetData.TargetLocation = Owner->GetActorLocation();
+
+	// Warm-up outside the measurement (subsystem lookups, lazy statics)
+	FTargetingResultArray Targets;
+	Strategy->GetValidTargets(TargetData, Targets);
+
+	// Scoped to the targeting buffers' own heap allocator - no global allocator swap
+	const int32 AllocationsBefore = TargetingScratchAllocations::GetHeapAllocationCount();
+
+	int32 TotalTargets = 0;
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		// Clear the per-frame validate memo so every target is classified again
+		Strategy->ResetValidateMemo();
+
+		Strategy->GetValidTargets(TargetData, Targets);
+		TotalTargets += Targets.Num();
+	}
+
+	const int32 Allocations = TargetingScratchAllocations::GetHeapAllocationCount() - AllocationsBefore;
+	AddInfo(FString::Printf(TEXT("%d queries, %.1f targets/query, %d heap allocations"),
+		Iterations, static_cast<float>(TotalTargets) / Iterations, Allocations));
+
+	TestEqual(TEXT("Targets per query"), TotalTargets, Iterations * Config.MaxTargets);
+	TestEqual(TEXT("Targeting buffer heap allocations during buffered queries"), Allocations, 0);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
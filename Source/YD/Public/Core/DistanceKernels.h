@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Squared-distance kernels over SoA (separate X/Y/Z float arrays) candidate positions.
+ * The vector versions use UE's VectorRegister4Float abstraction (SSE on x64, NEON on ARM),
+ * four candidates per iteration with a scalar tail. No sqrt anywhere - compare squared distances.
+ */
+namespace DistanceKernels
+{
+	/** OutDistSquared[i] = |P[i] - Origin|^2 for i in [0, Num) */
+	YD_API void ComputeDistSquared(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float* OutDistSquared);
+
+	/** Index of the nearest position strictly closer than MaxDistSquared, INDEX_NONE if none */
+	YD_API int32 FindNearest(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float MaxDistSquared = TNumericLimits<float>::Max());
+
+	/**
+	 * Indices of the K nearest positions, nearest first (ties broken by index).
+	 * DistSquared must hold the result of ComputeDistSquared for the same positions.
+	 * @return Number of indices written to OutIndices
+	 */
+	YD_API int32 SelectKNearest(const float* DistSquared, int32 Num, int32 K, int32* OutIndices);
+
+	/**
+	 * OutInside[i] = 1 if P[i] is within MaxDistSquared of Origin and inside the cone around Direction (unit length)
+	 * whose half-angle has cosine CosHalf, 0 otherwise. Compares D.V against |V| cos(Half) squared - no trig or sqrt.
+	 * @return Number of positions inside
+	 */
+	YD_API int32 ConeMask(const FVector3f& Origin, const FVector3f& Direction, float CosHalf, float MaxDistSquared, const float* X, const float* Y, const float* Z, int32 Num, uint8* OutInside);
+
+	/** Scalar reference versions (benchmark and correctness checks) */
+	YD_API void ComputeDistSquaredScalar(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float* OutDistSquared);
+	YD_API int32 FindNearestScalar(const FVector3f& Origin, const float* X, const float* Y, const float* Z, int32 Num, float MaxDistSquared = TNumericLimits<float>::Max());
+	YD_API int32 ConeMaskScalar(const FVector3f& Origin, const FVector3f& Direction, float CosHalf, float MaxDistSquared, const float* X, const float* Y, const float* Z, int32 Num, uint8* OutInside);
+}
+
+/** SoA position buffer with inline storage, for gathering candidates before running the kernels */
+template<int32 InlineCount, typename SecondaryAllocator = FDefaultAllocator>
+struct TSoAPositions
+{
+	TArray<float, TInlineAllocator<InlineCount, SecondaryAllocator>> X;
+	TArray<float, TInlineAllocator<InlineCount, SecondaryAllocator>> Y;
+	TArray<float, TInlineAllocator<InlineCount, SecondaryAllocator>> Z;
+
+	int32 Num() const { return X.Num(); }
+
+	void Reset()
+	{
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+	}
+
+	void Add(float InX, float InY, float InZ)
+	{
+		X.Add(InX);
+		Y.Add(InY);
+		Z.Add(InZ);
+	}
+
+	void Add(const FVector& Position)
+	{
+		Add(static_cast<float>(Position.X), static_cast<float>(Position.Y), static_cast<float>(Position.Z));
+	}
+
+	int32 FindNearest(const FVector3f& Origin, float MaxDistSquared = TNumericLimits<float>::Max()) const
+	{
+		return DistanceKernels::FindNearest(Origin, X.GetData(), Y.GetData(), Z.GetData(), Num(), MaxDistSquared);
+	}
+
+	void ComputeDistSquared(const FVector3f& Origin, float* OutDistSquared) const
+	{
+		DistanceKernels::ComputeDistSquared(Origin, X.GetData(), Y.GetData(), Z.GetData(), Num(), OutDistSquared);
+	}
+
+	int32 ConeMask(const FVector3f& Origin, const FVector3f& Direction, float CosHalf, float MaxDistSquared, uint8* OutInside) const
+	{
+		return DistanceKernels::ConeMask(Origin, Direction, CosHalf, MaxDistSquared, X.GetData(), Y.GetData(), Z.GetData(), Num(), OutInside);
+	}
+};
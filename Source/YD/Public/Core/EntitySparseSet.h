@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Stable reference to an entry in a TEntitySparseSet - goes stale when the entry is removed */
+struct FEntityHandle
+{
+	int32 Slot = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Slot != INDEX_NONE; }
+
+	bool operator==(const FEntityHandle& Other) const { return Slot == Other.Slot && Generation == Other.Generation; }
+	bool operator!=(const FEntityHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Sparse set of keys with O(1) add, remove and lookup.
+ * Entries are dense and swap-removed, so owners can keep parallel column arrays:
+ * Remove returns the dense index that was freed, and the owner RemoveAtSwap's its columns at that index.
+ * Handles stay valid across other removals; generation counters reject handles to removed entries.
+ */
+template<typename KeyType>
+class TEntitySparseSet
+{
+public:
+	/** Add a key at dense index Num()-1. Returns an unset handle if the key is already present. */
+	FEntityHandle Add(const KeyType& Key)
+	{
+		if (KeyToHandle.Contains(Key))
+			return FEntityHandle();
+
+		int32 Slot;
+		if (FreeSlots.Num() > 0)
+		{
+			Slot = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			Slot = SlotToDense.Add(INDEX_NONE);
+			SlotGeneration.Add(0);
+		}
+
+		SlotToDense[Slot] = DenseToSlot.Add(Slot);
+
+		FEntityHandle Handle;
+		Handle.Slot = Slot;
+		Handle.Generation = SlotGeneration[Slot];
+		KeyToHandle.Add(Key, Handle);
+		return Handle;
+	}
+
+	/** Remove a key. Returns the freed dense index (swap-remove parallel columns there), INDEX_NONE if absent. */
+	int32 Remove(const KeyType& Key)
+	{
+		FEntityHandle Handle;
+		if (!KeyToHandle.RemoveAndCopyValue(Key, Handle))
+			return INDEX_NONE;
+
+		return RemoveSlot(Handle.Slot);
+	}
+
+	bool Contains(const KeyType& Key) const { return KeyToHandle.Contains(Key); }
+
+	FEntityHandle FindHandle(const KeyType& Key) const
+	{
+		const FEntityHandle* Handle = KeyToHandle.Find(Key);
+		return Handle ? *Handle : FEntityHandle();
+	}
+
+	int32 FindDenseIndex(const KeyType& Key) const
+	{
+		const FEntityHandle* Handle = KeyToHandle.Find(Key);
+		return Handle ? SlotToDense[Handle->Slot] : INDEX_NONE;
+	}
+
+	bool IsValid(const FEntityHandle& Handle) const
+	{
+		return SlotGeneration.IsValidIndex(Handle.Slot) && SlotGeneration[Handle.Slot] == Handle.Generation && SlotToDense[Handle.Slot] != INDEX_NONE;
+	}
+
+	/** Dense index of a handle, INDEX_NONE if the handle is stale */
+	int32 GetDenseIndex(const FEntityHandle& Handle) const
+	{
+		return IsValid(Handle) ? SlotToDense[Handle.Slot] : INDEX_NONE;
+	}
+
+	int32 Num() const { return DenseToSlot.Num(); }
+
+	void Reset()
+	{
+		SlotToDense.Reset();
+		SlotGeneration.Reset();
+		DenseToSlot.Reset();
+		FreeSlots.Reset();
+		KeyToHandle.Reset();
+	}
+
+	void Reserve(int32 Number)
+	{
+		SlotToDense.Reserve(Number);
+		SlotGeneration.Reserve(Number);
+		DenseToSlot.Reserve(Number);
+		KeyToHandle.Reserve(Number);
+	}
+
+private:
+	int32 RemoveSlot(int32 Slot)
+	{
+		const int32 DenseIndex = SlotToDense[Slot];
+		const int32 LastDense = DenseToSlot.Num() - 1;
+
+		// Move the last entry into the freed dense slot, same as RemoveAtSwap on the owner's columns
+		if (DenseIndex != LastDense)
+		{
+			const int32 MovedSlot = DenseToSlot[LastDense];
+			DenseToSlot[DenseIndex] = MovedSlot;
+			SlotToDense[MovedSlot] = DenseIndex;
+		}
+		DenseToSlot.Pop(EAllowShrinking::No);
+
+		SlotToDense[Slot] = INDEX_NONE;
+		SlotGeneration[Slot]++;
+		FreeSlots.Add(Slot);
+
+		return DenseIndex;
+	}
+
+	TArray<int32> SlotToDense;
+	TArray<uint32> SlotGeneration;
+	TArray<int32> DenseToSlot;
+	TArray<int32> FreeSlots;
+	TMap<KeyType, FEntityHandle> KeyToHandle;
+};
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Poolable.generated.h"
+
+UINTERFACE(MinimalAPI)
+class UPoolable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Actors that UActorPoolSubsystem can recycle instead of destroying.
+ * Hiding, collision and actor tick are handled by the pool - implementers reset their own state.
+ */
+class YD_API IPoolable
+{
+	GENERATED_BODY()
+
+public:
+	/** Called when a pooled actor is handed out again, after owner and transform are set (BeginPlay doesn't run again) */
+	virtual void OnAcquiredFromPool() = 0;
+
+	/** Called when the actor goes back to the pool - stop movement, clear delegates and timers */
+	virtual void OnReturnedToPool() = 0;
+};
@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AbilityDefinitionSubsystem.generated.h"
+
+class UAbilityData;
+class UAbilityDefinition;
+
+/**
+ * Cache of compiled ability definitions, one per UAbilityData.
+ * Every ability instance using the same data asset shares its targeting strategy, effects and level table.
+ */
+UCLASS()
+class YD_API UAbilityDefinitionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
+
+	/** Compiled definition for Data, compiling it on first use */
+	UAbilityDefinition* GetDefinition(UAbilityData* Data);
+
+	/** Drop all compiled definitions (e.g. after editing data assets in PIE) */
+	UFUNCTION(BlueprintCallable, Category = "Abilities")
+	void ClearDefinitions() { Definitions.Empty(); }
+
+	UFUNCTION(BlueprintPure, Category = "Abilities")
+	int32 GetDefinitionCount() const { return Definitions.Num(); }
+
+protected:
+	UPROPERTY()
+	TMap<UAbilityData*, UAbilityDefinition*> Definitions;
+};
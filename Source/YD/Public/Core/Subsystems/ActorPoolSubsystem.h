@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPoolSubsystem.generated.h"
+
+/** Inactive actors of one class */
+USTRUCT()
+struct FActorPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> InactiveActors;
+};
+
+/**
+ * Generic pool for short-lived actors (projectiles, AOE actors).
+ * Classes implementing IPoolable are recycled on release; anything else is destroyed as usual.
+ */
+UCLASS()
+class YD_API UActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Get an actor of the class - reused from the pool if available, spawned otherwise */
+	UFUNCTION(BlueprintCallable, Category = "Actor Pool")
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator);
+
+	template<typename T>
+	T* Acquire(TSubclassOf<T> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator)
+	{
+		return Cast<T>(AcquireActor(ActorClass, Location, Rotation, Owner, Instigator));
+	}
+
+	/**
+	 * Acquire with Setup run before the actor activates - before OnAcquiredFromPool on reuse, before BeginPlay on spawn.
+	 * Use it for state the activation reads (e.g. projectile speed before Launch).
+	 */
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Setup);
+
+	/** Acquire from the world's pool if there is one, spawn (deferred, same Setup order) otherwise */
+	static AActor* AcquireOrSpawn(UWorld* World, TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Setup);
+
+	template<typename T>
+	static T* AcquireOrSpawn(UWorld* World, TSubclassOf<T> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(T*)> Setup)
+	{
+		return Cast<T>(AcquireOrSpawn(World, ActorClass, Location, Rotation, Owner, Instigator, [&Setup](AActor* Actor)
+		{
+			Setup(CastChecked<T>(Actor));
+		}));
+	}
+
+	/** Give an actor back to the pool (destroys it if it isn't poolable or the pool is full) */
+	UFUNCTION(BlueprintCallable, Category = "Actor Pool")
+	void ReleaseActor(AActor* Actor);
+
+	/** Release through the world's pool if there is one, destroy otherwise */
+	static void ReleaseOrDestroy(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category = "Actor Pool")
+	int32 GetPooledCount(TSubclassOf<AActor> ActorClass) const;
+
+	/** Acquires served from the pool */
+	UFUNCTION(BlueprintPure, Category = "Actor Pool")
+	int32 GetPoolHits() const { return PoolHits; }
+
+	/** Acquires that had to spawn */
+	UFUNCTION(BlueprintPure, Category = "Actor Pool")
+	int32 GetPoolMisses() const { return PoolMisses; }
+
+protected:
+	static AActor* SpawnDeferred(UWorld* World, TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Setup);
+
+	/** Inactive actors kept per class - extra releases are destroyed */
+	UPROPERTY(EditAnywhere, Category = "Actor Pool")
+	int32 MaxPooledPerClass = 64;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AActor>, FActorPoolBucket> Buckets;
+
+	int32 PoolHits = 0;
+	int32 PoolMisses = 0;
+};
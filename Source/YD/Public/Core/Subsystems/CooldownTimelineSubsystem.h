@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "CooldownTimelineSubsystem.generated.h"
+
+class UAbility;
+
+/**
+ * World-level cooldown timeline.
+ * Abilities store an absolute end time and register it here; expiries sit in a min-heap
+ * and the tick only pops entries that are due, so idle casters cost nothing per frame.
+ */
+UCLASS()
+class YD_API UCooldownTimelineSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !IsTemplate(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UCooldownTimelineSubsystem, STATGROUP_Tickables); }
+
+	/** Clock all cooldown end times are expressed in (server world time when a game state exists) */
+	double GetTime() const;
+
+	/**
+	 * Call Ability->OnCooldownExpired() once GetTime() reaches ExpireTime.
+	 * Serial must match Ability->CooldownSerial at expiry, otherwise the entry is ignored (cheap cancel).
+	 */
+	void Schedule(UAbility* Ability, double ExpireTime, uint32 Serial);
+
+	/** Entries in the heap, including cancelled ones not yet popped */
+	UFUNCTION(BlueprintPure, Category = "Cooldown")
+	int32 GetNumScheduled() const { return Timeline.Num(); }
+
+protected:
+	struct FCooldownEntry
+	{
+		double ExpireTime = 0.0;
+		TWeakObjectPtr<UAbility> Ability;
+		uint32 Serial = 0;
+	};
+
+	/** Earliest expiry first */
+	struct FEarlierExpiry
+	{
+		bool operator()(const FCooldownEntry& A, const FCooldownEntry& B) const { return A.ExpireTime < B.ExpireTime; }
+	};
+
+	TArray<FCooldownEntry> Timeline;
+};
@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "WorldCollision.h"
+#include "LineOfSightSubsystem.generated.h"
+
+/** Result of a line-of-sight query */
+UENUM(BlueprintType)
+enum class ELineOfSightResult : uint8
+{
+	Visible,
+	Blocked,
+	Pending     // No cached result yet - an async trace has been requested
+};
+
+/** Coarse cell pair a LOS result is cached under */
+struct FLineOfSightKey
+{
+	FIntVector FromCell;
+	FIntVector ToCell;
+
+	bool operator==(const FLineOfSightKey& Other) const { return FromCell == Other.FromCell && ToCell == Other.ToCell; }
+
+	friend uint32 GetTypeHash(const FLineOfSightKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.FromCell), GetTypeHash(Key.ToCell));
+	}
+};
+
+/**
+ * Line-of-sight service for targeting.
+ * Requests made during a frame are issued as async visibility traces on the next tick,
+ * and results are cached per coarse cell pair for CacheTTL seconds.
+ */
+UCLASS()
+class YD_API ULineOfSightSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !IsTemplate(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(ULineOfSightSubsystem, STATGROUP_Tickables); }
+
+	/** Cached result, or Pending after queueing an async trace (non-critical consumers) */
+	ELineOfSightResult QueryLineOfSight(const AActor* From, const AActor* To);
+
+	/** Cached result, or a synchronous trace whose result is cached (critical consumers) */
+	bool HasLineOfSightSync(const AActor* From, const AActor* To);
+
+	/** Drop all cached results and pending requests */
+	UFUNCTION(BlueprintCallable, Category = "Line Of Sight")
+	void ClearCache();
+
+	UFUNCTION(BlueprintPure, Category = "Line Of Sight")
+	int32 GetCacheHits() const { return CacheHits; }
+
+	UFUNCTION(BlueprintPure, Category = "Line Of Sight")
+	int32 GetCacheMisses() const { return CacheMisses; }
+
+	/** Traces issued (async and sync) */
+	UFUNCTION(BlueprintPure, Category = "Line Of Sight")
+	int32 GetTracesIssued() const { return TracesIssued; }
+
+	UFUNCTION(BlueprintCallable, Category = "Line Of Sight")
+	void ResetCounters() { CacheHits = 0; CacheMisses = 0; TracesIssued = 0; }
+
+	/** Cache cell edge length - endpoints in the same cells share a result */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Line Of Sight")
+	float CacheCellSize;
+
+	/** Seconds a cached result stays valid */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Line Of Sight")
+	float CacheTTL;
+
+	/** Async traces issued per tick; the rest wait for the next frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Line Of Sight")
+	int32 MaxTracesPerFrame;
+
+protected:
+	struct FCachedResult
+	{
+		bool bVisible = false;
+		double ExpireTime = 0.0;
+	};
+
+	struct FTraceRequest
+	{
+		FLineOfSightKey Key;
+		FVector Start;
+		FVector End;
+		TWeakObjectPtr<const AActor> From;
+		TWeakObjectPtr<const AActor> To;
+	};
+
+	struct FInFlightTrace
+	{
+		FLineOfSightKey Key;
+		FTraceHandle Handle;
+	};
+
+	FLineOfSightKey MakeKey(const FVector& From, const FVector& To) const;
+
+	/** Cached result for a key if it hasn't expired */
+	const FCachedResult* FindValid(const FLineOfSightKey& Key) const;
+
+	void StoreResult(const FLineOfSightKey& Key, bool bVisible);
+
+	/** Collect finished async traces into the cache */
+	void CollectFinishedTraces();
+
+	/** Issue queued requests as async traces */
+	void IssueQueuedTraces();
+
+	void PruneExpired();
+
+	TMap<FLineOfSightKey, FCachedResult> Cache;
+
+	/** Keys queued or in flight, so a pair is only traced once */
+	TSet<FLineOfSightKey> PendingKeys;
+
+	/** Requests collected this frame */
+	TArray<FTraceRequest> QueuedRequests;
+
+	/** Async traces waiting for results */
+	TArray<FInFlightTrace> InFlightTraces;
+
+	float PruneTimer;
+
+	int32 CacheHits;
+	int32 CacheMisses;
+	int32 TracesIssued;
+};
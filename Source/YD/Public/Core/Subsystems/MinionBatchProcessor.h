@@ -5,9 +5,115 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Tickable.h"
+#include "Core/EntitySparseSet.h"
+#include "Core/DistanceKernels.h"
 #include "MinionBatchProcessor.generated.h"
 
 class AEnemy_Base;
+class UCharacterStatComponent;
+class UCombatComponent;
+class USpatialHashSubsystem;
+class ULineOfSightSubsystem;
+
+/** Movement state of a processor-driven minion */
+enum class EMinionMoveState : uint8
+{
+	Idle,
+	Chasing,
+	InRange
+};
+
+/**
+ * Packed per-minion state, one column per field.
+ * Row i always describes RegisteredMinions[i] - rows are added and swap-removed together.
+ */
+struct FMinionStateTable
+{
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<uint8> Team;
+	TArray<uint8> bAlive;
+
+	/** Row in the target table of the current combat target, INDEX_NONE if none */
+	TArray<int32> TargetIndex;
+
+	TArray<float> AttackRange;
+	TArray<float> DetectionRange;
+
+	/** Detection ignores enemies behind walls (AEnemy_Base::bDetectionRequiresLineOfSight) */
+	TArray<uint8> bNeedsLineOfSight;
+
+	/** Chase/stop state and repath timer, only used when the processor drives movement */
+	TArray<EMinionMoveState> MoveState;
+	TArray<float> MoveTimer;
+
+	int32 Num() const { return PositionX.Num(); }
+
+	void AddRow(uint8 InTeam, float InDetectionRange, bool bInNeedsLineOfSight);
+	void RemoveRowSwap(int32 Row);
+	void Reset();
+};
+
+/**
+ * Snapshot of potential targets for the current target pass.
+ * Row i mirrors spatial hash entry i, so hash queries index straight into it.
+ * Only the entries around this pass's searches are copied - other rows hold data from older passes.
+ */
+struct FMinionTargetTable
+{
+	TArray<AActor*> Actors;
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<uint8> Team;
+	TArray<uint8> bAlive;
+
+	/** Pass that last wrote each row */
+	TArray<uint32> FilledPass;
+
+	uint32 Pass = 0;
+
+	int32 Num() const { return Actors.Num(); }
+
+	/** True if Row was written during the current pass */
+	bool IsFilled(int32 Row) const { return FilledPass.IsValidIndex(Row) && FilledPass[Row] == Pass; }
+
+	/** Start a new pass over NumEntries hash entries - every row becomes stale */
+	void BeginPass(int32 NumEntries);
+	void Reset();
+};
+
+/** Per-frame numbers from the time-sliced target scheduler */
+USTRUCT(BlueprintType)
+struct FMinionSchedulerStats
+{
+	GENERATED_BODY()
+
+	/** Minions whose target search ran last frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Minion Batch")
+	int32 MinionsProcessedLastFrame = 0;
+
+	/** Of those, minions whose target had just died or become invalid */
+	UPROPERTY(BlueprintReadOnly, Category = "Minion Batch")
+	int32 PriorityProcessedLastFrame = 0;
+
+	/** Minions that wanted a search last frame but were pushed to a later frame by the budget */
+	UPROPERTY(BlueprintReadOnly, Category = "Minion Batch")
+	int32 DeferredLastFrame = 0;
+
+	/** Time spent in the scheduler last frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Minion Batch")
+	float LastFrameMicroseconds = 0.f;
+
+	/** Worst frame since the stats were reset */
+	UPROPERTY(BlueprintReadOnly, Category = "Minion Batch")
+	float PeakFrameMicroseconds = 0.f;
+
+	/** Frames where the budget ran out with work left */
+	UPROPERTY(BlueprintReadOnly, Category = "Minion Batch")
+	int32 BudgetOverruns = 0;
+};
 
 /**
  * Batch processor for minions - handles all minion AI updates in one place for performance
@@ -39,21 +145,123 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Minion Batch")
 	int32 GetRegisteredCount() const { return RegisteredMinions.Num(); }
 
+	/** Team id used by the packed tables (0 = no team, hostile to everyone) - see UTeamComponent */
+	static uint8 GetTeamId(const AActor* Actor);
+
+	/** Scheduler stats, for verifying that target searches are spread across frames */
+	UFUNCTION(BlueprintPure, Category = "Minion Batch")
+	const FMinionSchedulerStats& GetSchedulerStats() const { return SchedulerStats; }
+
+	UFUNCTION(BlueprintCallable, Category = "Minion Batch")
+	void ResetSchedulerStats() { SchedulerStats = FMinionSchedulerStats(); }
+
+	/** Drive chase/stop/attack-range movement from the processor and disable minion actor tick */
+	UFUNCTION(BlueprintCallable, Category = "Minion Batch")
+	void SetDriveMinionMovement(bool bEnable);
+
+	UFUNCTION(BlueprintPure, Category = "Minion Batch")
+	bool IsDrivingMinionMovement() const { return bDriveMinionMovement; }
+
 protected:
 	/** All minions being batch processed */
 	UPROPERTY()
 	TArray<AEnemy_Base*> RegisteredMinions;
 
-	/** Timer for target updates */
-	float TargetUpdateTimer;
+	/** Minion -> row, O(1) register/unregister; rows are swap-removed together with the columns */
+	TEntitySparseSet<TObjectKey<AEnemy_Base>> MinionRows;
+
+	/** Cached combat components, parallel to RegisteredMinions */
+	UPROPERTY()
+	TArray<UCombatComponent*> MinionCombat;
+
+	/** Cached stat components, parallel to RegisteredMinions */
+	UPROPERTY()
+	TArray<UCharacterStatComponent*> MinionStats;
+
+	/** Packed minion state, parallel to RegisteredMinions */
+	FMinionStateTable MinionTable;
 
-	/** How often to update targets (in seconds) */
+	/** Packed target candidates for the current pass */
+	FMinionTargetTable TargetTable;
+
+	/** How long a minion without a target may wait between searches (in seconds) */
 	UPROPERTY(EditAnywhere, Category = "Minion Batch")
 	float TargetUpdateInterval;
 
-	/** Batch update all minion targets */
-	void BatchUpdateTargets();
+	/** Per-frame time budget for target searches (in microseconds) */
+	UPROPERTY(EditAnywhere, Category = "Minion Batch")
+	float TargetBudgetMicroseconds;
+
+	/** Next row to visit in the round-robin over minions without a target */
+	int32 RoundRobinCursor;
+
+	/** Fractional round-robin quota carried to the next frame */
+	float RoundRobinAccumulator;
+
+	UPROPERTY()
+	FMinionSchedulerStats SchedulerStats;
+
+	/** Stat component per candidate actor, so the target table doesn't search components every frame */
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<UCharacterStatComponent>> TargetStatsCache;
+
+	/** When true, registered minions don't tick - their movement state machine runs in UpdateMinionMovement */
+	UPROPERTY(EditAnywhere, Category = "Minion Batch")
+	bool bDriveMinionMovement;
+
+	/** How often a chasing minion re-issues its move request (in seconds) */
+	UPROPERTY(EditAnywhere, Category = "Minion Batch")
+	float MoveUpdateInterval;
+
+	/** Run the nearest-enemy search on worker threads (results are identical to the serial path) */
+	UPROPERTY(EditAnywhere, Category = "Minion Batch")
+	bool bParallelTargetSearch;
+
+	/** Minions per ParallelFor task */
+	UPROPERTY(EditAnywhere, Category = "Minion Batch")
+	int32 TargetSearchChunkSize;
+
+	/** Rows that need a new target this pass */
+	TArray<int32> SearchRows;
+
+	/** Target table row found for each SearchRows entry (written by the parallel phase) */
+	TArray<int32> SearchResults;
+
+	/** Time-sliced target update: priority minions first, then a round-robin slice, within the budget */
+	void BatchUpdateTargets(float DeltaTime, const USpatialHashSubsystem* SpatialHash);
+
+	/** Chase until in attack range, then stop once - replaces AEnemy_Base::Tick for driven minions */
+	void UpdateMinionMovement(float DeltaTime);
+
+	/** Copy positions, ranges and alive state from the components into the minion table */
+	void SyncMinionTable();
+	void SyncMinionRow(int32 Row);
+
+	bool IsMinionAlive(int32 Row) const;
+
+	/** Copy the hash entries around SearchRows[Start, End) into the target table, once per entry per pass */
+	void FillTargetTable(const USpatialHashSubsystem* SpatialHash, int32 Start, int32 End);
+
+	/** Cached stat component of a candidate target */
+	UCharacterStatComponent* FindTargetStats(AActor* Actor);
+
+	/** Read-only phase: fill SearchResults for SearchRows[Start, End), in parallel chunks */
+	void SearchTargets(const USpatialHashSubsystem* SpatialHash, int32 Start, int32 End);
+
+	/** Serial phase: write found targets for SearchRows[Start, End) back to combat components and movement */
+	void ApplyTargets(const USpatialHashSubsystem* SpatialHash, int32 Start, int32 End);
+
+	/** Enemy candidates near the minion: positions in SoA, target table rows in OutEntries. Thread-safe. */
+	void GatherEnemyCandidates(int32 MinionRow, const USpatialHashSubsystem* SpatialHash, TSoAPositions<64>& OutPositions, TArray<int32, TInlineAllocator<64>>& OutEntries) const;
+
+	/** Find closest enemy (target table row) within the minion's detection range. Thread-safe. */
+	int32 FindClosestEnemy(int32 MinionRow, const USpatialHashSubsystem* SpatialHash) const;
+
+	/**
+	 * Closest enemy the minion can see, nearest first over at most MaxLineOfSightCandidates candidates.
+	 * Uses deferred LOS like the per-actor detection strategy - a pending trace counts as not visible. Game thread only.
+	 */
+	int32 FindClosestVisibleEnemy(int32 MinionRow, int32 NearestIndex, const USpatialHashSubsystem* SpatialHash, ULineOfSightSubsystem* LineOfSight);
 
-	/** Find closest enemy for a minion from a list of potential targets */
-	AActor* FindClosestEnemy(AEnemy_Base* Minion, const TArray<FOverlapResult>& PotentialTargets) const;
+	/** Candidates checked for line of sight per search */
+	static constexpr int32 MaxLineOfSightCandidates = 8;
 };
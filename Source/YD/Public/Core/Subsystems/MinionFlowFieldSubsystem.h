@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MinionFlowFieldSubsystem.generated.h"
+
+class AController;
+
+/** A unit moving towards a shared goal */
+struct FFlowFieldFollower
+{
+	TWeakObjectPtr<AController> Controller;
+
+	/** True while the follower is outside the field and uses a regular navmesh path */
+	bool bOnNavPath = false;
+};
+
+/**
+ * Integration field around one goal actor: cost-to-goal per cell in a square window centered on the goal.
+ * Followers step towards the cheapest neighbour of their cell.
+ */
+struct FMinionFlowField
+{
+	TWeakObjectPtr<AActor> Goal;
+	TArray<FFlowFieldFollower> Followers;
+
+	/** Cell of the window's min corner, and the goal's cell when the field was built */
+	FIntPoint Origin = FIntPoint::ZeroValue;
+	FIntPoint GoalCell = FIntPoint::ZeroValue;
+	int32 Width = 0;
+
+	/** Cost to goal per window cell, MAX_uint16 = unreachable */
+	TArray<uint16> Cost;
+
+	float LastBuildTime = -1.f;
+
+	/** Followers are currently steered by the field (enough of them share this goal) */
+	bool bFieldActive = false;
+};
+
+/**
+ * Shared movement for units chasing the same goal.
+ * Goals with several followers get one flow field sampled by every follower, so a wave chasing
+ * one champion costs one field build instead of one navmesh path query per minion.
+ * Goals with a single follower, and followers outside the field window, fall back to navmesh pathing.
+ */
+UCLASS()
+class YD_API UMinionFlowFieldSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !IsTemplate(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UMinionFlowFieldSubsystem, STATGROUP_Tickables); }
+
+	/** Move a controlled unit towards Goal - replaces UAIBlueprintHelperLibrary::SimpleMoveToActor */
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	void MoveToActor(AController* Controller, AActor* Goal);
+
+	/** Stop a unit and drop it from its goal's followers */
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	void StopMovement(AController* Controller);
+
+	/** Navmesh path requests issued since the last reset */
+	UFUNCTION(BlueprintPure, Category = "Flow Field")
+	int32 GetNavPathRequestCount() const { return NavPathRequests; }
+
+	/** Flow fields built since the last reset */
+	UFUNCTION(BlueprintPure, Category = "Flow Field")
+	int32 GetFieldBuildCount() const { return FieldBuilds; }
+
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	void ResetCounters() { NavPathRequests = 0; FieldBuilds = 0; }
+
+protected:
+	/** Edge length of a field cell */
+	UPROPERTY(EditAnywhere, Category = "Flow Field")
+	float FieldCellSize;
+
+	/** Window half size in cells - followers further than this from the goal use navmesh paths */
+	UPROPERTY(EditAnywhere, Category = "Flow Field")
+	int32 FieldHalfExtentCells;
+
+	/** Followers needed before a goal gets a field instead of individual paths */
+	UPROPERTY(EditAnywhere, Category = "Flow Field")
+	int32 MinFollowersForField;
+
+	/** Minimum time between rebuilds of one field while its goal moves (in seconds) */
+	UPROPERTY(EditAnywhere, Category = "Flow Field")
+	float FieldRebuildInterval;
+
+	/** Height of one walkability layer - cells are cached per (X, Y, layer) so stacked floors don't share a result */
+	UPROPERTY(EditAnywhere, Category = "Flow Field")
+	float WalkableLayerHeight;
+
+	/** Navmesh projections allowed per tick - a field whose cells aren't all known yet is built on a later tick */
+	UPROPERTY(EditAnywhere, Category = "Flow Field")
+	int32 MaxWalkableProbesPerTick;
+
+	/** Goal -> field and followers */
+	TMap<TObjectKey<AActor>, FMinionFlowField> Fields;
+
+	/** Follower -> goal, so a follower belongs to at most one field */
+	TMap<TObjectKey<AController>, TObjectKey<AActor>> FollowerGoals;
+
+	/** Walkable state per world cell and height layer, filled lazily from the navmesh (the level is static) */
+	TMap<FIntVector, bool> WalkableCache;
+
+	int32 NavPathRequests;
+	int32 FieldBuilds;
+
+	/** Probes left this tick (reset to MaxWalkableProbesPerTick) */
+	int32 WalkableProbeBudget;
+
+	FIntPoint GetCell(const FVector& Location) const;
+	FVector GetCellCenter(const FIntPoint& Cell, float Z) const;
+
+	/** Cached walkability, probing the navmesh if the budget allows - false if the cell is still unknown */
+	bool TryGetCellWalkable(const FIntPoint& Cell, float Z, bool& bOutWalkable);
+
+	/** Dijkstra from the goal cell over the window - false (field untouched) while window cells are still being probed */
+	bool BuildField(FMinionFlowField& Field, const FVector& GoalLocation);
+
+	/** Direction to steer from Location, or zero if the field doesn't cover it */
+	FVector SampleField(const FMinionFlowField& Field, const FVector& Location, const FVector& GoalLocation) const;
+
+	void RemoveFollower(AController* Controller);
+
+	void RequestNavPath(AController* Controller, AActor* Goal);
+};
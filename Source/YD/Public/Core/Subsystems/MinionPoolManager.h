@@ -4,54 +4,191 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Core/EntitySparseSet.h"
 #include "MinionPoolManager.generated.h"
 
 class AEnemy_Base;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPoolWarmupComplete, int32, PooledCount);
+
+/** What a sub-pool does with minions it no longer needs */
+UENUM(BlueprintType)
+enum class EMinionPoolTrimPolicy : uint8
+{
+	KeepAll,              // Never destroy pooled minions
+	DestroyOverCapacity,  // Returned minions beyond Capacity are destroyed instead of pooled
+	TrimToHighWaterMark   // Every TrimInterval, destroy idle minions above the recent peak of active ones
+};
+
+/** Per-class pool settings */
+USTRUCT(BlueprintType)
+struct FMinionPoolConfig
+{
+	GENERATED_BODY()
+
+	/** Minions pre-spawned during warm-up */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion Pool")
+	int32 InitialSize = 20;
+
+	/** Inactive minions kept for reuse (0 = unlimited) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion Pool")
+	int32 Capacity = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion Pool")
+	EMinionPoolTrimPolicy TrimPolicy = EMinionPoolTrimPolicy::KeepAll;
+
+	/** Seconds between trims for TrimToHighWaterMark */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion Pool")
+	float TrimInterval = 30.f;
+};
+
+/** Active and inactive minions of one class */
+USTRUCT()
+struct FMinionSubPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AEnemy_Base> MinionClass;
+
+	/** Currently active minions */
+	UPROPERTY()
+	TArray<AEnemy_Base*> ActiveMinions;
+
+	/** Minion -> index in ActiveMinions, for O(1) return */
+	TEntitySparseSet<TObjectKey<AEnemy_Base>> ActiveIndex;
+
+	/** Inactive minions ready for reuse */
+	UPROPERTY()
+	TArray<AEnemy_Base*> InactiveMinions;
+
+	UPROPERTY()
+	FMinionPoolConfig Config;
+
+	/** Peak active count since the last trim */
+	int32 HighWaterMark = 0;
+
+	/** Minions warm-up still has to spawn */
+	int32 PendingWarmup = 0;
+
+	float TrimTimer = 0.f;
+};
+
 /**
- * Object Pooling system for minions to reduce spawn/destroy overhead
+ * Object Pooling system for minions to reduce spawn/destroy overhead.
+ * Each minion class has its own sub-pool, so several minion types can be pooled at once.
  */
 UCLASS()
-class YD_API UMinionPoolManager : public UWorldSubsystem
+class YD_API UMinionPoolManager : public UWorldSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
 public:
-	/** Initialize the pool with a specific minion class */
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !IsTemplate() && SubPools.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UMinionPoolManager, STATGROUP_Tickables); }
+
+	/** Start filling the pool for a minion class - spawns are spread over frames (SpawnsPerFrame) */
 	UFUNCTION(BlueprintCallable, Category = "Minion Pool")
 	void InitializePool(TSubclassOf<AEnemy_Base> MinionClass, int32 InitialPoolSize = 20);
 
-	/** Get a minion from the pool (reuses if available, spawns new if not) */
+	/** Start filling the pool for a minion class with its own capacity and trim policy */
+	UFUNCTION(BlueprintCallable, Category = "Minion Pool")
+	void InitializePoolWithConfig(TSubclassOf<AEnemy_Base> MinionClass, const FMinionPoolConfig& Config);
+
+	/** Get a minion of the first pooled class (reuses if available, spawns new if not - also while warm-up is still running) */
 	UFUNCTION(BlueprintCallable, Category = "Minion Pool")
 	AEnemy_Base* GetMinion(const FVector& SpawnLocation, const FRotator& SpawnRotation);
 
-	/** Return a minion to the pool (instead of destroying) */
+	/** Get a minion of a specific class, creating its sub-pool on first use */
+	UFUNCTION(BlueprintCallable, Category = "Minion Pool")
+	AEnemy_Base* GetMinionOfClass(TSubclassOf<AEnemy_Base> MinionClass, const FVector& SpawnLocation, const FRotator& SpawnRotation);
+
+	/** Return a minion to its class's pool (instead of destroying) */
 	UFUNCTION(BlueprintCallable, Category = "Minion Pool")
 	void ReturnMinion(AEnemy_Base* Minion);
 
-	/** Get number of active minions */
+	/** Get number of active minions across all classes */
 	UFUNCTION(BlueprintPure, Category = "Minion Pool")
-	int32 GetActiveCount() const { return ActiveMinions.Num(); }
+	int32 GetActiveCount() const;
 
-	/** Get number of inactive (pooled) minions */
+	/** Get number of inactive (pooled) minions across all classes */
 	UFUNCTION(BlueprintPure, Category = "Minion Pool")
-	int32 GetInactiveCount() const { return InactiveMinions.Num(); }
+	int32 GetInactiveCount() const;
+
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	int32 GetActiveCountOfClass(TSubclassOf<AEnemy_Base> MinionClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	int32 GetInactiveCountOfClass(TSubclassOf<AEnemy_Base> MinionClass) const;
+
+	/** Peak active count of a class since its last trim */
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	int32 GetHighWaterMarkOfClass(TSubclassOf<AEnemy_Base> MinionClass) const;
+
+	/** True if the minion was handed out by this pool and hasn't been returned yet */
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	bool IsActivePooledMinion(const AEnemy_Base* Minion) const;
+
+	/** GetMinion calls served from inactive minions */
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	int32 GetPoolHits() const { return PoolHits; }
+
+	/** GetMinion calls that had to spawn a new minion */
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	int32 GetPoolMisses() const { return PoolMisses; }
+
+	/** Fraction of GetMinion calls served from the pool (0-1) */
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	float GetPoolHitRate() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Minion Pool")
+	void ResetPoolCounters() { PoolHits = 0; PoolMisses = 0; }
+
+	/** True while InitializePool is still spawning minions */
+	UFUNCTION(BlueprintPure, Category = "Minion Pool")
+	bool IsWarmingUp() const { return PendingWarmupCount > 0; }
+
+	/** Broadcast once the pool has spawned everything InitializePool asked for */
+	UPROPERTY(BlueprintAssignable, Category = "Minion Pool")
+	FOnPoolWarmupComplete OnPoolWarmupComplete;
+
+	/** Minions spawned per frame during warm-up, across all classes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion Pool")
+	int32 SpawnsPerFrame;
 
 protected:
-	/** The minion class to spawn */
+	/** Class -> sub-pool */
 	UPROPERTY()
-	TSubclassOf<AEnemy_Base> MinionClassToSpawn;
+	TMap<TSubclassOf<AEnemy_Base>, FMinionSubPool> SubPools;
 
-	/** Currently active minions */
+	/** Class served by GetMinion without a class */
 	UPROPERTY()
-	TArray<AEnemy_Base*> ActiveMinions;
+	TSubclassOf<AEnemy_Base> DefaultMinionClass;
 
-	/** Inactive minions ready for reuse */
-	UPROPERTY()
-	TArray<AEnemy_Base*> InactiveMinions;
+	/** Minions warm-up still has to spawn, across all sub-pools */
+	int32 PendingWarmupCount;
+
+	int32 PoolHits;
+	int32 PoolMisses;
+
+	/** Find or create the sub-pool for a class (null if the class can't be pooled) */
+	FMinionSubPool* FindOrAddSubPool(TSubclassOf<AEnemy_Base> MinionClass);
+
+	/** Count one warm-up spawn as done, broadcasting when the last one finishes */
+	void ConsumeWarmup(FMinionSubPool& SubPool);
+
+	/** Destroy idle minions according to the sub-pool's trim policy */
+	void TrimSubPool(FMinionSubPool& SubPool);
 
-	/** Spawn a new minion and add to pool */
-	AEnemy_Base* SpawnNewMinion();
+	/** Spawn a new minion of the given class */
+	AEnemy_Base* SpawnNewMinion(TSubclassOf<AEnemy_Base> MinionClass);
 
 	/** Deactivate minion (hide and disable) */
 	void DeactivateMinion(AEnemy_Base* Minion);
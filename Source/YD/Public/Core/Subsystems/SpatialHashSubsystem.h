@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "SpatialHashSubsystem.generated.h"
+
+/**
+ * Uniform 2D spatial hash of gameplay actors - replaces physics overlaps for unit proximity queries.
+ * Registered actors are re-bucketed incrementally every tick, only when they cross a cell boundary.
+ */
+UCLASS()
+class YD_API USpatialHashSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !IsTemplate(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(USpatialHashSubsystem, STATGROUP_Tickables); }
+
+	/** Add an actor to the spatial hash */
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void RegisterActor(AActor* Actor);
+
+	/** Remove an actor from the spatial hash */
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void UnregisterActor(AActor* Actor);
+
+	/** Refresh a single actor's cell immediately (e.g. after a teleport) */
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void UpdateActor(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category = "Spatial Hash")
+	bool IsRegistered(const AActor* Actor) const { return Actor && ActorToEntry.Contains(Actor); }
+
+	UFUNCTION(BlueprintPure, Category = "Spatial Hash")
+	int32 GetRegisteredCount() const { return EntryActors.Num(); }
+
+	/** Change the cell size and rebuild all buckets */
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void SetCellSize(float NewCellSize);
+
+	UFUNCTION(BlueprintPure, Category = "Spatial Hash")
+	float GetCellSize() const { return CellSize; }
+
+	/**
+	 * Report the radius of a recurring proximity query (e.g. a minion's DetectionRange).
+	 * The cell size follows the largest radius reported, so such a query touches at most 3x3 cells.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void ReserveQueryRadius(float Radius);
+
+	/** Collect registered actors within Radius of Center */
+	void QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, const AActor* IgnoreActor = nullptr) const;
+
+	/** Collect up to K registered actors within MaxRadius of Center, nearest first */
+	void QueryKNearest(const FVector& Center, int32 K, float MaxRadius, TArray<AActor*>& OutActors, const AActor* IgnoreActor = nullptr) const;
+
+	/**
+	 * Visit every entry within Radius of Center. Func(int32 EntryIndex, float DistSquared)
+	 * Read-only - safe to call from worker threads while the hash is not being modified.
+	 */
+	template<typename FuncType>
+	void ForEachEntryInRadius(const FVector& Center, float Radius, FuncType&& Func) const;
+
+	/**
+	 * Visit every entry in the cells overlapping the radius, without a distance check. Func(int32 EntryIndex)
+	 * For callers that keep their own packed copy of entry positions.
+	 */
+	template<typename FuncType>
+	void ForEachEntryNear(const FVector& Center, float Radius, FuncType&& Func) const;
+
+	// ===========================
+	// Range Triggers
+	// ===========================
+
+	/**
+	 * One-shot trigger: OnEnter runs on the first tick Source is within Radius of Target (3D).
+	 * Only re-evaluated when Source or Target moved, so a waiting trigger costs nothing while both stand still.
+	 * OnCancel runs instead if an endpoint is unregistered (e.g. a pooled minion deactivated) or destroyed first.
+	 * @return Handle for RemoveRangeTrigger
+	 */
+	int32 AddRangeTrigger(const AActor* Source, const AActor* Target, float Radius, FSimpleDelegate OnEnter, FSimpleDelegate OnCancel = FSimpleDelegate());
+
+	/** Cancel a trigger that hasn't fired yet (no-op for stale handles) */
+	void RemoveRangeTrigger(int32 Handle);
+
+	UFUNCTION(BlueprintPure, Category = "Spatial Hash")
+	int32 GetRangeTriggerCount() const { return RangeTriggers.Num(); }
+
+	/** Entry accessors (indices are only stable until the next register/unregister/tick) */
+	int32 GetNumEntries() const { return EntryActors.Num(); }
+	AActor* GetEntryActor(int32 EntryIndex) const { return EntryActors[EntryIndex]; }
+	const FVector& GetEntryLocation(int32 EntryIndex) const { return EntryLocations[EntryIndex]; }
+	int32 FindEntryIndex(const AActor* Actor) const;
+
+protected:
+	/** Cell edge length - the largest reserved query radius, DefaultCellSize until one is reserved */
+	UPROPERTY(EditAnywhere, Category = "Spatial Hash")
+	float CellSize;
+
+	/** Cell size used before any query radius is reserved */
+	UPROPERTY(EditAnywhere, Category = "Spatial Hash")
+	float DefaultCellSize;
+
+	/** Largest radius passed to ReserveQueryRadius so far */
+	float LargestQueryRadius;
+
+	/** Registered actors (dense, swap-removed) */
+	UPROPERTY()
+	TArray<AActor*> EntryActors;
+
+	/** Cached locations, parallel to EntryActors */
+	TArray<FVector> EntryLocations;
+
+	/** Current cell of each entry, parallel to EntryActors */
+	TArray<FIntPoint> EntryCells;
+
+	/** Actor -> entry index */
+	TMap<const AActor*, int32> ActorToEntry;
+
+	/** Cell -> entry indices */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	struct FRangeTrigger
+	{
+		TWeakObjectPtr<const AActor> Source;
+		TWeakObjectPtr<const AActor> Target;
+		float RadiusSquared = 0.f;
+		FSimpleDelegate OnEnter;
+		FSimpleDelegate OnCancel;
+
+		/** An endpoint isn't in the hash, so its movement can't be observed - checked every tick */
+		bool bPollEveryTick = false;
+	};
+
+	/** Handle -> trigger */
+	TMap<int32, FRangeTrigger> RangeTriggers;
+
+	/** Actor -> handles of triggers it is an endpoint of */
+	TMap<const AActor*, TArray<int32, TInlineAllocator<2>>> TriggersByActor;
+
+	/** Triggers to evaluate this tick (an endpoint moved) */
+	TArray<int32> DirtyTriggers;
+
+	int32 NextTriggerHandle = 0;
+
+	/** Queue an actor's triggers for evaluation */
+	void MarkTriggersDirty(const AActor* Actor);
+
+	/** Evaluate dirty/polled triggers and fire the ones whose endpoints are now in range */
+	void EvaluateRangeTriggers();
+
+	void UnlinkTrigger(int32 Handle, const FRangeTrigger& Trigger);
+
+	/** Drop every trigger Actor is an endpoint of and run their OnCancel */
+	void CancelTriggersFor(const AActor* Actor);
+
+	FIntPoint GetCellKey(const FVector& Location) const;
+
+	void AddToCell(int32 EntryIndex, const FIntPoint& Cell);
+	void RemoveFromCell(int32 EntryIndex, const FIntPoint& Cell);
+
+	/** Swap-remove an entry, keeping cell lists and the lookup map in sync */
+	void RemoveEntryAt(int32 EntryIndex);
+
+	/** Move an entry to its new location, re-bucketing only when the cell changes */
+	void RefreshEntry(int32 EntryIndex, const FVector& NewLocation);
+};
+
+template<typename FuncType>
+void USpatialHashSubsystem::ForEachEntryNear(const FVector& Center, float Radius, FuncType&& Func) const
+{
+	if (Radius <= 0.f || EntryActors.Num() == 0)
+		return;
+
+	const FIntPoint MinCell = GetCellKey(Center - FVector(Radius, Radius, 0.f));
+	const FIntPoint MaxCell = GetCellKey(Center + FVector(Radius, Radius, 0.f));
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellY));
+			if (!CellEntries)
+				continue;
+
+			for (int32 EntryIndex : *CellEntries)
+			{
+				Func(EntryIndex);
+			}
+		}
+	}
+}
+
+template<typename FuncType>
+void USpatialHashSubsystem::ForEachEntryInRadius(const FVector& Center, float Radius, FuncType&& Func) const
+{
+	const float RadiusSquared = Radius * Radius;
+
+	ForEachEntryNear(Center, Radius, [this, &Center, RadiusSquared, &Func](int32 EntryIndex)
+	{
+		const float DistSquared = FVector::DistSquared(Center, EntryLocations[EntryIndex]);
+		if (DistSquared <= RadiusSquared)
+		{
+			Func(EntryIndex, DistSquared);
+		}
+	});
+}
@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Gameplay/Data/TargetingStrategy.h"
+#include "TargetingQueryCacheSubsystem.generated.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Hits"), STAT_TargetingQueryCacheHits, STATGROUP_YDTargeting, YD_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Misses"), STAT_TargetingQueryCacheMisses, STATGROUP_YDTargeting, YD_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Validate Memo Hits"), STAT_TargetingValidateMemoHits, STATGROUP_YDTargeting, YD_API);
+
+/** Everything a buffered targeting query's result depends on, with positions quantized */
+struct FTargetingQueryKey
+{
+	FIntVector Origin = FIntVector::ZeroValue;
+	FIntVector TargetLocation = FIntVector::ZeroValue;
+	FIntVector Direction = FIntVector::ZeroValue;
+	const AActor* TargetActor = nullptr;
+
+	/** Set only when the result can't be shared with other owners (e.g. the filter could match the owner itself) */
+	const AActor* Owner = nullptr;
+
+	float Range = 0.f;
+	float Radius = 0.f;
+	float Width = 0.f;
+	float Angle = 0.f;
+	int32 MaxTargets = 0;
+	int32 FilterMask = 0;
+	uint8 TargetingType = 0;
+	uint8 ObserverTeamId = 0;
+	uint8 Flags = 0;
+
+	bool operator==(const FTargetingQueryKey& Other) const
+	{
+		return Origin == Other.Origin
+			&& TargetLocation == Other.TargetLocation
+			&& Direction == Other.Direction
+			&& TargetActor == Other.TargetActor
+			&& Owner == Other.Owner
+			&& Range == Other.Range
+			&& Radius == Other.Radius
+			&& Width == Other.Width
+			&& Angle == Other.Angle
+			&& MaxTargets == Other.MaxTargets
+			&& FilterMask == Other.FilterMask
+			&& TargetingType == Other.TargetingType
+			&& ObserverTeamId == Other.ObserverTeamId
+			&& Flags == Other.Flags;
+	}
+
+	friend uint32 GetTypeHash(const FTargetingQueryKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.Origin), GetTypeHash(Key.TargetLocation));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Direction));
+		Hash = HashCombine(Hash, GetTypeHash(Key.TargetActor));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Owner));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Range));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Radius));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Width));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Angle));
+		Hash = HashCombine(Hash, GetTypeHash(Key.MaxTargets));
+		Hash = HashCombine(Hash, GetTypeHash(Key.FilterMask));
+		return HashCombine(Hash, (Key.TargetingType << 16) | (Key.ObserverTeamId << 8) | Key.Flags);
+	}
+};
+
+/**
+ * Per-frame memo of targeting query results.
+ * Minions asking the same question from nearly the same spot share one result; everything is dropped when the frame changes.
+ */
+UCLASS()
+class YD_API UTargetingQueryCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Copy this frame's result for Key into OutTargets. False on a miss. */
+	bool Find(const FTargetingQueryKey& Key, FTargetingResultArray& OutTargets);
+
+	/** Remember a result for the rest of this frame */
+	void Store(const FTargetingQueryKey& Key, const FTargetingResultArray& Targets);
+
+	/** Quantize a position to the cache grid */
+	FIntVector QuantizeLocation(const FVector& Location) const;
+
+	UFUNCTION(BlueprintPure, Category = "Targeting")
+	int32 GetCacheHits() const { return CacheHits; }
+
+	UFUNCTION(BlueprintPure, Category = "Targeting")
+	int32 GetCacheMisses() const { return CacheMisses; }
+
+	/** Fraction of cacheable queries served from the memo (0-1) */
+	UFUNCTION(BlueprintPure, Category = "Targeting")
+	float GetHitRate() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Targeting")
+	void ResetCounters() { CacheHits = 0; CacheMisses = 0; }
+
+	/** Queries whose origins fall in the same cell share results */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Targeting")
+	float QuantizeCellSize;
+
+	/** Turn the memo off (every query recomputes) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Targeting")
+	bool bEnabled;
+
+protected:
+	/** Drop last frame's results (storage is kept for reuse) */
+	void BeginFrameIfNeeded();
+
+	/** Key -> slot in Results */
+	TMap<FTargetingQueryKey, int32> ResultIndex;
+
+	/** Result storage, reused frame to frame */
+	TArray<TArray<AActor*>> Results;
+
+	int32 NumResultsUsed;
+
+	uint64 CachedFrame;
+
+	int32 CacheHits;
+	int32 CacheMisses;
+};
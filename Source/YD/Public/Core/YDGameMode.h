@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "Core/Subsystems/MinionPoolManager.h"
 #include "YDGameMode.generated.h"
 
 class UMinionPoolManager;
@@ -47,6 +48,14 @@ protected:
 	/** Initial pool size for minion pooling */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Manager|Minions")
 	int32 InitialPoolSize = 20;
+
+	/** Extra minion types pooled alongside MinionClass (casters, siege, neutral camps) - spawned by portals whose MinionClass is set */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Manager|Minions")
+	TMap<TSubclassOf<AEnemy_Base>, FMinionPoolConfig> AdditionalMinionPools;
+
+	/** Let the batch processor drive minion movement instead of per-minion actor tick */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Manager|Minions")
+	bool bBatchDriveMinionMovement = false;
 };
 
 
@@ -4,18 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Core/Poolable.h"
 #include "AOE_Base.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAOE_OverlapActor, AActor*, TargetActor);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAOE_OverlapActors, const TArray<AActor*>&, TargetActors);
 
 UCLASS()
-class YD_API AAOE_Base : public AActor
+class YD_API AAOE_Base : public AActor, public IPoolable
 {
 	GENERATED_BODY()
 	
 public:	
 	// Sets default values for this actor's properties
 	AAOE_Base();
+
+	// IPoolable interface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReturnedToPool() override;
 	
 	void SpawnAOE_Sphere();
 
@@ -25,6 +31,11 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	// Schedule the BeginPlay trigger - on spawn and on every reuse from the pool
+	void StartTriggerTimer();
+
+	void ReleaseToPool();
+
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AOE|Settings")
 	float Radius;
@@ -38,7 +49,17 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AOE|Debug")
 	bool bDrawDebugSphere;
 
+	/** Seconds the AOE stays visible after triggering before it goes back to the pool */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AOE|Settings")
+	float ReleaseDelay = 0.5f;
+
+	FTimerHandle ReleaseTimerHandle;
+
 public:
 	UPROPERTY(BlueprintAssignable, Category = "AOE")
 	FOnAOE_OverlapActor OnOverlapActor;
+
+	/** All actors hit by one trigger, broadcast once (preferred for applying effects) */
+	UPROPERTY(BlueprintAssignable, Category = "AOE")
+	FOnAOE_OverlapActors OnOverlapActors;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Core/Poolable.h"
 #include "Projectile_Base.generated.h"
 
 class UArrowComponent;
@@ -13,7 +14,7 @@ class UProjectileMovementComponent;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnProjectileImpact, AActor*, OtherActor, FHitResult, Hit);
 
 UCLASS()
-class YD_API AProjectile_Base : public AActor
+class YD_API AProjectile_Base : public AActor, public IPoolable
 {
 	GENERATED_BODY()
 	
@@ -21,6 +22,10 @@ public:
 	// Sets default values for this actor's properties
 	AProjectile_Base();
 
+	// IPoolable interface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReturnedToPool() override;
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -28,6 +33,9 @@ protected:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
+	// Set velocity, play spawn sound and ignore the owner - on spawn and on every reuse from the pool
+	void Launch();
+
 	// Rotate to Target if Valid
 	void RotateToTarget();
 
@@ -37,6 +45,9 @@ protected:
 
 	void SpawnImpactEffect(FVector Location);
 
+	// Missed the target - back to the pool
+	void OnLifetimeExpired();
+
 	UFUNCTION()
 	void OnComponentHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent, FVector NormalImpulse, const FHitResult& Hit);
 
@@ -66,6 +77,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile|Settings")
 	bool bIsHoming = false;
 
+	/** Seconds before a projectile that hit nothing is released (0 = never) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile|Settings", meta = (ClampMin = "0.0"))
+	float MaxLifetime = 5.f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile|Settings")
 	float HeightAboveGround = 80.f;
 
@@ -86,4 +101,9 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile|Effect")
 	UParticleSystem* ImpactEffect;
+
+	/** Sitting in the actor pool - ignore late hit events */
+	bool bInPool = false;
+
+	FTimerHandle LifetimeTimer;
 };
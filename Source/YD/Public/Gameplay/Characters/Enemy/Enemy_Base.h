@@ -30,6 +30,15 @@ public:
 
 	virtual bool IsEnemy(AActor* Actor) const;
 
+	UFUNCTION(BlueprintPure, Category = "AI")
+	float GetDetectionRange() const { return DetectionRange; }
+
+	UFUNCTION(BlueprintPure, Category = "AI")
+	bool DoesDetectionRequireLineOfSight() const { return bDetectionRequiresLineOfSight; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy")
+	AActor* GetMovementTarget() const { return MovementTarget; }
+
 	UFUNCTION()
 	void HandleDeath();
 
@@ -39,9 +48,6 @@ protected:
 
 	virtual void OnDeath(AActor* Killer);
 
-	UFUNCTION(BlueprintPure, Category = "Enemy")
-	AActor* GetMovementTarget() const { return MovementTarget; }
-
 	UFUNCTION(BlueprintPure, Category = "Enemy")
 	int32 GetGoldReward() const { return GoldReward; }
 
@@ -52,6 +58,9 @@ protected:
 
 	void InitializeTargetingStrategy();
 
+	/** Corpse timer expired - hand the minion back to the pool */
+	void ReturnToPool();
+
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
 	AActor* MovementTarget;
@@ -65,9 +74,19 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	float DetectionRange;
 
+	/** Ignore enemies behind walls (deferred async LOS - a target becomes visible once its trace completes) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	bool bDetectionRequiresLineOfSight;
+
 	float DetectionTimer;
 	float MoveUpdateTimer;
 
+	/** Seconds the corpse stays before it is returned to the pool (or destroyed if not pooled) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float CorpseDuration;
+
+	FTimerHandle CorpseTimerHandle;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
 	UAnimMontage* AttackMontage;
 
@@ -13,6 +13,7 @@ class UInputMappingContext;
 class UInputAction;
 class UCharacterStatComponent;
 class UCombatComponent;
+class UTeamComponent;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
@@ -25,6 +26,10 @@ class AYDCharacter : public ACharacter
 public:
 	AYDCharacter();
 
+	UTeamComponent* GetTeamComponent() const { return TeamComponent; }
+
+	UCharacterStatComponent* GetCharacterStatComponent() const { return CharacterStatComponent; }
+
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats", meta = (AllowPrivateAccess = "true"))
 	UCharacterStatComponent* CharacterStatComponent;
@@ -32,9 +37,13 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
 	UCombatComponent* CombatComponent;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Team", meta = (AllowPrivateAccess = "true"))
+	UTeamComponent* TeamComponent;
+
 protected:
 	// APawn interface
 	virtual void BeginPlay();
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 };
 
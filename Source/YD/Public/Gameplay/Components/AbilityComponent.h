@@ -76,7 +76,4 @@ protected:
 	/** Currently casting ability (set during Execute, used by AnimNotify) */
 	UPROPERTY()
 	UAbility* CurrentCastingAbility;
-
-public:
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 };
@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TeamComponent.generated.h"
+
+/** Team ids (None = no team, hostile to everyone) */
+UENUM(BlueprintType)
+enum class EYDTeam : uint8
+{
+	None    = 0,
+	Enemy   = 1,    // Minion side ("Enemy" tag)
+	Player  = 2     // Player side ("Player" / "Champion" tag)
+};
+
+/** Packed team data of one actor */
+struct FTeamInfo
+{
+	uint8 TeamId = 0;
+
+	/** ETargetFilter bits describing the unit type (Minion, Champion, Structure, Neutral) */
+	int32 UnitTypeMask = 0;
+
+	/** Has any gameplay-relevant tag - actors without one are terrain/background */
+	bool bTargetable = false;
+};
+
+/**
+ * Cached team and unit type, so targeting doesn't scan Tags on every query.
+ * By default the values are derived once from the owner's tags when the component registers.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class YD_API UTeamComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTeamComponent();
+
+	virtual void OnRegister() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UFUNCTION(BlueprintPure, Category = "Team")
+	EYDTeam GetTeam() const { return static_cast<EYDTeam>(Info.TeamId); }
+
+	UFUNCTION(BlueprintCallable, Category = "Team")
+	void SetTeam(EYDTeam NewTeam);
+
+	UFUNCTION(BlueprintPure, Category = "Team")
+	int32 GetUnitTypeMask() const { return Info.UnitTypeMask; }
+
+	/** Re-read team and unit type from the owner's tags */
+	UFUNCTION(BlueprintCallable, Category = "Team")
+	void RefreshFromTags();
+
+	const FTeamInfo& GetTeamInfo() const { return Info; }
+
+	// ===========================
+	// Relations (component when present, tags otherwise)
+	// ===========================
+
+	/** Team data of any actor */
+	static FTeamInfo GetTeamInfo(const AActor* Actor);
+
+	/** Team data computed from tags */
+	static FTeamInfo ComputeFromTags(const AActor* Actor);
+
+	static uint8 GetTeamId(const AActor* Actor) { return GetTeamInfo(Actor).TeamId; }
+
+	static bool IsTargetable(const AActor* Actor) { return GetTeamInfo(Actor).bTargetable; }
+
+	/** Same non-zero team, or the same actor */
+	static bool AreAllies(const AActor* A, const AActor* B);
+
+	/** Different actors that aren't allies */
+	static bool AreEnemies(const AActor* A, const AActor* B) { return A != B && !AreAllies(A, B); }
+
+	/** ETargetFilter bits Target matches as seen by Observer (relation | unit type) */
+	static int32 ClassifyTarget(const AActor* Target, const AActor* Observer);
+
+	/** Same, with the observer's team looked up once by the caller for a whole batch */
+	static int32 ClassifyTarget(const AActor* Target, const AActor* Observer, uint8 ObserverTeamId);
+
+protected:
+	/** Derive team and unit type from the owner's tags on register */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Team")
+	bool bDeriveFromTags = true;
+
+	/** Used when bDeriveFromTags is false */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Team", meta = (EditCondition = "!bDeriveFromTags"))
+	EYDTeam Team = EYDTeam::None;
+
+	/** Used when bDeriveFromTags is false */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Team", meta = (Bitmask, BitmaskEnum = "/Script/YD.ETargetFilter", EditCondition = "!bDeriveFromTags"))
+	int32 UnitTypeMask = 0;
+
+	/**
+	 * Register a targetable non-character owner (structures, neutral camps) with the spatial hash,
+	 * so hash-based targeting finds it. Characters register themselves.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Team")
+	bool bRegisterWithSpatialHash = true;
+
+	/** True if BeginPlay registered the owner */
+	bool bRegisteredWithSpatialHash = false;
+
+	FTeamInfo Info;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "TargetingStrategy.h"
+#include "AbilityDefinition.h"
 #include "UObject/Object.h"
 #include "Ability.generated.h"
 
@@ -11,10 +12,13 @@ enum class EAbilitySlot : uint8;
 class UAbilityComponent;
 class UAbilityData;
 class UAbilityEffect;
+class UCharacterStatComponent;
+class UCooldownTimelineSubsystem;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAbilityExecuted, UAbility*, Ability, FAbilityTargetData, TargetData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAbilityCastStarted, UAbility*, Ability, float, CastTime);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityCastCancelled, UAbility*, Ability);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityCooldownEnded, UAbility*, Ability);
 /**
  * 
  */
@@ -37,13 +41,27 @@ public:
     
 	UPROPERTY()
 	EAbilitySlot AbilitySlot;  // Q=0, W=1, E=2, R=3
+
+	// 소유자 스탯 (마나 체크/소모용, Initialize 시 캐싱)
+	UPROPERTY()
+	UCharacterStatComponent* OwnerStats;
+
+	UPROPERTY()
+	UCooldownTimelineSubsystem* CooldownTimeline;
     
 	// ============ Runtime State ============
-	UPROPERTY(Replicated)
+	UPROPERTY(ReplicatedUsing = OnRep_CurrentLevel)
 	int32 CurrentLevel = 0;  // 0 = 스킬 배우지 않음
+
+	// 현재 레벨 수치 (Initialize/레벨 변경 시 정의의 레벨 테이블에서 복사)
+	FAbilityLevelStats LevelStats;
     
+	// 쿨다운 종료 시각 (UCooldownTimelineSubsystem::GetTime 기준) - 남은 시간은 조회 시 계산
 	UPROPERTY(Replicated)
-	float RemainingCooldown = 0.0f;
+	double CooldownEndTime = 0.0;
+
+	// 타임라인 엔트리 식별용 - 쿨다운을 다시 걸거나 취소하면 증가
+	uint32 CooldownSerial = 0;
     
 	UPROPERTY(Replicated)
 	int32 CurrentCharges = 1;
@@ -55,15 +73,20 @@ public:
 	bool bHasPendingExecution = false;
 	FAbilityTargetData PendingExecutionTargetData;
 
+	// USpatialHashSubsystem 사거리 진입 트리거 핸들 (INDEX_NONE = 없음)
+	int32 PendingRangeTrigger = INDEX_NONE;
+
 	// ============================================
 	// Runtime Objects
 	// ============================================
     
+	// 같은 AbilityData를 쓰는 인스턴스끼리 공유하는 정의 (타겟팅 전략, 이펙트, 레벨 테이블)
 	UPROPERTY()
-	UTargetingStrategy* TargetingStrategy;
-    
+	UAbilityDefinition* Definition;
+
+	// CustomTargetingClass 전략 - 소유자와 함께 초기화, 공유하지 않음
 	UPROPERTY()
-	TArray<UAbilityEffect*> RuntimeEffects;
+	UTargetingStrategy* CustomTargetingStrategy = nullptr;
     
 	UPROPERTY()
 	FTimerHandle CastTimerHandle;
@@ -90,16 +113,23 @@ public:
 
 	// ============ Queries(외부에서 조회) ============
 	bool CanCast() const;
-	bool IsOnCooldown() const { return RemainingCooldown > 0.0f && CurrentCharges == 0; }
+	bool IsOnCooldown() const;
 	bool IsMaxLevel() const;
     
-	float GetManaCost() const;
-	float GetCooldown() const;
-	float GetRange() const;
+	float GetManaCost() const { return LevelStats.ManaCost; }
+	float GetCooldown() const { return LevelStats.Cooldown; }
+	float GetRange() const { return LevelStats.Range; }
+	float GetDamageMultiplier() const { return LevelStats.DamageMultiplier; }
 	float GetCooldownPercent() const;
 
-	void UpdateCooldown(float DeltaTime);
+	/** 남은 쿨다운 (충전형이면 다음 충전까지) - 월드 시간에서 계산 */
+	UFUNCTION(BlueprintPure, Category = "Ability")
+	float GetRemainingCooldown() const;
+
+	/** 쿨다운 타임라인에서 만료 시 호출 */
+	void OnCooldownExpired();
 
+	/** 사거리 진입 트리거에서 호출 - 대기 중인 시전 실행 */
 	UFUNCTION()
 	void CheckPendingExecution();
 
@@ -115,11 +145,26 @@ public:
     
 	UPROPERTY(BlueprintAssignable)
 	FOnAbilityCastCancelled OnAbilityCastCancelled;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnAbilityCooldownEnded OnCooldownEnded;
 	
 protected:
 	// ============ Initialization Helpers ============
-	void CreateTargetingStrategy();
-	void CreateRuntimeEffects();
+	/** 공유 정의 조회 (월드 캐시가 없으면 이 인스턴스 전용으로 컴파일) */
+	void ResolveDefinition();
+
+	/** CustomTargetingClass가 있으면 이 인스턴스 전용 전략을 소유자와 함께 생성 */
+	void CreateCustomTargetingStrategy();
+
+	/** 현재 레벨의 수치 행을 정의에서 복사 */
+	void RefreshLevelStats();
+
+	UFUNCTION()
+	void OnRep_CurrentLevel();
+
+	/** 커스텀 전략 또는 공유 전략 (Definition 소유) - 호출 시 FTargetingStrategyBinding으로 이 인스턴스에 바인딩 */
+	UTargetingStrategy* GetTargetingStrategy() const;
 
 	// ============ Validation ============
 	bool ValidateTargetData(const FAbilityTargetData& TargetData) const;
@@ -137,12 +182,27 @@ protected:
 	void ExecuteProjectile(const FAbilityTargetData& TargetData);
 	void ExecuteAOE(const FAbilityTargetData& TargetData);
 
+	/** 투사체 속도/호밍 설정 - 풀에서 꺼낸 투사체가 발사(Launch)되기 전에 호출 */
+	void ConfigureProjectile(AProjectile_Base* Projectile, AActor* HomingTarget) const;
+
 	void ApplyEffectsToActor(AActor* Target);
 
+	/** 시전자 스탯 한 번 스냅샷, 대상 스탯 컴포넌트 한 번 조회 후 이펙트별로 배치 적용 */
+	void ApplyEffectsToTargets(TArrayView<AActor* const> Targets);
+
 	void ConsumeResources();
 	void RefundResources();
 	void StartCooldown();
 
+	/** 지금부터 Duration 뒤에 끝나는 쿨다운을 타임라인에 등록 */
+	void ScheduleCooldown(float Duration);
+
+	/** 진행 중인 쿨다운 취소 (힙 엔트리는 시리얼 불일치로 무시됨) */
+	void ClearCooldown();
+
+	/** 등록된 사거리 진입 트리거 해제 */
+	void RemovePendingRangeTrigger();
+
 	void PlayPresentation(const FVector& Location);
 
 	// Helpers (TargetingStrategy 활용)
@@ -153,5 +213,5 @@ protected:
 	void OnProjectileHit(AActor* HitActor, FHitResult Hit);
 
 	UFUNCTION()
-	void OnAOEOverlap(AActor* OverlappedActor);
+	void OnAOEOverlap(const TArray<AActor*>& OverlappedActors);
 };
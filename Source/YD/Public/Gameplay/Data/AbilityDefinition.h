@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "AbilityDefinition.generated.h"
+
+class UAbilityData;
+class UAbilityEffect;
+class UTargetingStrategy;
+
+// 레벨별로 미리 계산한 수치 (LevelScaling 적용 완료)
+struct FAbilityLevelStats
+{
+	float ManaCost = 0.0f;
+	float Cooldown = 0.0f;
+	float Range = 0.0f;
+	float DamageMultiplier = 1.0f;
+};
+
+/**
+ * UAbilityData에서 컴파일한 읽기 전용 어빌리티 정의
+ * 같은 데이터 에셋을 쓰는 모든 UAbility 인스턴스가 공유 (타겟팅 전략, 이펙트, 레벨 테이블)
+ * 인스턴스별 상태(레벨, 쿨다운, 충전)는 UAbility에 남음
+ */
+UCLASS()
+class YD_API UAbilityDefinition : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Data로부터 전략/이펙트/레벨 테이블 생성 */
+	void Compile(UAbilityData* InData);
+
+	/** 레벨별 수치 - 0 또는 범위 밖 레벨은 기본값 */
+	const FAbilityLevelStats& GetLevelStats(int32 Level) const
+	{
+		return LevelStats.IsValidIndex(Level) ? LevelStats[Level] : LevelStats[0];
+	}
+
+	UPROPERTY()
+	UAbilityData* Data = nullptr;
+
+	/**
+	 * 공유 타겟팅 전략 - 소유자 없이 초기화, 호출 시 FTargetingStrategyBinding으로 바인딩
+	 * CustomTargetingClass가 있으면 nullptr (서브클래스는 소유자를 기대할 수 있어 UAbility가 인스턴스별로 생성)
+	 */
+	UPROPERTY()
+	UTargetingStrategy* TargetingStrategy = nullptr;
+
+	/** 공유 이펙트 (읽기 전용 - 소스 어빌리티와 레벨 배율은 FEffectInstigatorSnapshot으로 전달) */
+	UPROPERTY()
+	TArray<UAbilityEffect*> Effects;
+
+protected:
+	/** [0] = 기본값, [N] = 레벨 N */
+	TArray<FAbilityLevelStats> LevelStats;
+};
@@ -8,8 +8,38 @@
 #include "AbilityEffect.generated.h"
 
 class UAbility;
+class UCharacterStatComponent;
+
+/** 시전 시점의 시전자 스탯과 시전 컨텍스트 (배치당 한 번 캡처) - 공유 이펙트 객체 대신 여기로 전달 */
+struct FEffectInstigatorSnapshot
+{
+	AActor* Instigator = nullptr;
+
+	/** 이펙트를 적용하는 어빌리티 인스턴스 */
+	UAbility* SourceAbility = nullptr;
+
+	float AttackDamage = 0.0f;
+	float AbilityPower = 0.0f;
+
+	/** 어빌리티 레벨 피해 배율 (캡처만 함 - 피해 계산에는 아직 미적용) */
+	float DamageMultiplier = 1.0f;
+
+	static FEffectInstigatorSnapshot Capture(AActor* Instigator, const UCharacterStatComponent* InstigatorStats, UAbility* SourceAbility = nullptr, float DamageMultiplier = 1.0f);
+};
+
+/** 배치 대상 - 스탯 컴포넌트는 배치를 만들 때 한 번 조회 */
+struct FEffectBatchTarget
+{
+	AActor* Actor = nullptr;
+	UCharacterStatComponent* Stats = nullptr;
+
+	/** 캐릭터는 캐싱된 포인터, 그 외는 컴포넌트 검색 */
+	static UCharacterStatComponent* ResolveStats(AActor* Actor);
+};
+
 /**
- * 
+ * UAbilityDefinition이 소유하고 같은 어빌리티의 모든 시전자가 공유 - 읽기 전용
+ * 시전별 컨텍스트는 FEffectInstigatorSnapshot으로 받고, 지속시간 같은 상태가 필요하면 대상별 기록에 둘 것
  */
 UCLASS()
 class YD_API UAbilityEffect : public UObject
@@ -20,22 +50,23 @@ public:
 	UPROPERTY()
 	FAbilityEffectData EffectData;
     
-	UPROPERTY()
-	UAbility* SourceAbility;
-    
 	UPROPERTY()
 	float Duration = 0.0f;
     
-	UPROPERTY()
-	float RemainingDuration = 0.0f;
-    
-	void InitializeFromData(const FAbilityEffectData& InData, UAbility* Ability);
+	void InitializeFromData(const FAbilityEffectData& InData);
 	virtual void Apply(AActor* Target, AActor* Instigator);
+
+	/**
+	 * 여러 대상에 한 번에 적용 (시전자 스냅샷 공유)
+	 * 기본 구현은 대상마다 Apply 호출 - 서브클래스는 오버라이드해서 대상당 비용을 줄일 수 있음
+	 */
+	virtual void ApplyBatch(TArrayView<const FEffectBatchTarget> Targets, const FEffectInstigatorSnapshot& Snapshot);
 	virtual void OnApplied();
 	virtual void OnRemoved();
-	virtual void UpdateDuration(float DeltaTime);
-	bool IsExpired() const;
     
 protected:
 	float CalculateFinalValue(AActor* Instigator) const;
+
+	/** 스냅샷 기준 최종 수치 (BaseValue + AD/AP 계수, 레벨 배율 미적용) */
+	float CalculateFinalValue(const FEffectInstigatorSnapshot& Snapshot) const;
 };
@@ -16,4 +16,7 @@ class YD_API UDamageEffect : public UAbilityEffect
 
 public:
 	virtual void Apply(AActor* Target, AActor* Instigator) override;
+
+	/** Damage is computed once from the snapshot and dealt to every target with a stat component */
+	virtual void ApplyBatch(TArrayView<const FEffectBatchTarget> Targets, const FEffectInstigatorSnapshot& Snapshot) override;
 };
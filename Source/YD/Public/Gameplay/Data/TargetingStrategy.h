@@ -4,8 +4,76 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "Stats/Stats.h"
 #include "TargetingStrategy.generated.h"
 
+DECLARE_STATS_GROUP(TEXT("YD Targeting"), STATGROUP_YDTargeting, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Buffered Queries"), STAT_TargetingQueries, STATGROUP_YDTargeting, YD_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Buffer Spills To Heap"), STAT_TargetingBufferSpills, STATGROUP_YDTargeting, YD_API);
+
+/** 타겟 쿼리 출력 버퍼의 인라인 용량 */
+static constexpr int32 TargetingInlineCapacity = 32;
+
+/** 타겟팅 버퍼가 인라인 용량을 넘겨 힙에 할당한 횟수 (게임 스레드 쿼리 기준 - 테스트가 전역 할당자 대신 확인) */
+namespace TargetingScratchAllocations
+{
+	YD_API void NoteHeapAllocation();
+	YD_API int32 GetHeapAllocationCount();
+}
+
+/**
+ * 타겟팅 스크래치 버퍼의 힙 할당자 - FHeapAllocator와 같고 할당 횟수만 집계
+ * 인라인 용량을 넘을 때만 호출되므로 평소 경로에는 비용 없음
+ */
+class FTargetingHeapAllocator : public FHeapAllocator
+{
+public:
+	class ForAnyElementType : public FHeapAllocator::ForAnyElementType
+	{
+		using Super = FHeapAllocator::ForAnyElementType;
+
+	public:
+		void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement)
+		{
+			if (NewMax > 0)
+			{
+				TargetingScratchAllocations::NoteHeapAllocation();
+			}
+			Super::ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement);
+		}
+
+		void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement)
+		{
+			if (NewMax > 0)
+			{
+				TargetingScratchAllocations::NoteHeapAllocation();
+			}
+			Super::ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, AlignmentOfElement);
+		}
+	};
+
+	template<typename ElementType>
+	class ForElementType : public ForAnyElementType
+	{
+	public:
+		ElementType* GetAllocation() const
+		{
+			return (ElementType*)ForAnyElementType::GetAllocation();
+		}
+	};
+};
+
+template<>
+struct TAllocatorTraits<FTargetingHeapAllocator> : TAllocatorTraits<FHeapAllocator>
+{
+};
+
+/** 타겟팅 버퍼 할당자 - 인라인 용량을 넘으면 FTargetingHeapAllocator로 */
+using FTargetingInlineAllocator = TInlineAllocator<TargetingInlineCapacity, FTargetingHeapAllocator>;
+
+/** 타겟 쿼리 출력 버퍼 - 인라인 용량 안에서는 힙 할당 없음 */
+using FTargetingResultArray = TArray<AActor*, FTargetingInlineAllocator>;
+
 UENUM(BlueprintType)
 enum class ETargetingType : uint8
 {
@@ -62,6 +130,14 @@ struct FTargetingConfig
     
 	UPROPERTY(EditDefaultsOnly)
 	bool bCanTargetThroughWalls = false;
+
+	// 시야 결과가 캐시에 없으면 비동기 트레이스만 요청하고 이번 쿼리에서는 제외 (미니언 탐지 등 비핵심 용도)
+	UPROPERTY(EditDefaultsOnly)
+	bool bDeferLineOfSight = false;
+
+	// Spatial Hash에 없는 액터(TeamComponent 없는 구조물 등)도 물리 오버랩으로 수집 (모든 범위 형태, 비용 있음)
+	UPROPERTY(EditDefaultsOnly)
+	bool bOverlapUnregisteredActors = false;
     
 	UPROPERTY(EditDefaultsOnly)
 	int32 MaxTargets = 1;  // 다중 타겟 개수
@@ -88,6 +164,35 @@ struct FAbilityTargetData
 	UPROPERTY()
 	bool bIsValid = false;
 };
+
+// Initialize 시점에 TargetFilter를 컴파일한 결과
+struct FCompiledTargetFilter
+{
+	/** Config.TargetFilter (0 = 모두 통과) */
+	int32 Mask = 0;
+
+	/** 쿼리 배치 시작 시 캐싱한 OwningActor의 팀 */
+	uint8 ObserverTeamId = 0;
+
+	bool Passes(int32 Classification) const { return Mask == 0 || (Classification & Mask) != 0; }
+};
+
+struct FTargetingQueryKey;
+class UTargetingStrategy;
+
+/**
+ * 여러 어빌리티 인스턴스가 공유하는 전략을 스코프 동안 한 소유자/사거리에 바인딩 (스코프 종료 시 복원)
+ */
+struct YD_API FTargetingStrategyBinding
+{
+	FTargetingStrategyBinding(UTargetingStrategy& Strategy, AActor* Owner, float Range);
+
+private:
+	TGuardValue<AActor*> OwnerGuard;
+	TGuardValue<float> RangeGuard;
+	TGuardValue<uint8> TeamGuard;
+};
+
 /**
  * Targeting strategy for abilities
  * Handles target collection, validation, and filtering based on FTargetingConfig
@@ -97,6 +202,8 @@ class YD_API UTargetingStrategy : public UObject
 {
 	GENERATED_BODY()
 
+	friend struct FTargetingStrategyBinding;
+
 public:
 	
 	UPROPERTY()
@@ -124,6 +231,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Targeting")
 	virtual TArray<AActor*> GetValidTargets(const FAbilityTargetData& TargetData);
 
+	/**
+	 * 호출자 버퍼에 유효한 타겟을 채움 (OutTargets는 먼저 비움)
+	 * 기본 클래스 + Spatial Hash 경로는 인라인 용량 안에서 힙 할당 없음
+	 */
+	void GetValidTargets(const FAbilityTargetData& TargetData, FTargetingResultArray& OutTargets);
+
 	/**
 	 * 특정 액터가 타겟 가능한지 검증
 	 * @param Target - 검증할 액터
@@ -140,6 +253,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Targeting")
 	virtual bool ValidateTargetData(const FAbilityTargetData& TargetData) const;
 
+	/** 프레임 메모 비우기 (버킷 유지) - 테스트가 프레임을 넘기지 않고 매 쿼리를 새로 분류할 때 사용 */
+	void ResetValidateMemo() const { ValidateMemo.Reset(); }
+
 protected:
 	// ===========================
 	// Target Collection (타입별)
@@ -148,6 +264,12 @@ protected:
 	/** 타겟 타입에 따라 잠재적 타겟들 수집 */
 	virtual TArray<AActor*> CollectPotentialTargets(const FAbilityTargetData& TargetData);
 
+	/** 잠재적 타겟들을 호출자 버퍼에 수집 (OutTargets는 먼저 비움) */
+	void CollectPotentialTargets(const FAbilityTargetData& TargetData, FTargetingResultArray& OutTargets) const;
+
+	/** 타입별 수집 로직 본체 - OutTargets 뒤에 추가 */
+	void CollectTargetsOfType(ETargetingType Type, const FAbilityTargetData& TargetData, FTargetingResultArray& OutTargets) const;
+
 	/** None 타입: 자신 또는 주변 */
 	virtual TArray<AActor*> CollectTargets_None();
 
@@ -179,6 +301,15 @@ protected:
 	/** 타겟 필터 통과 여부 */
 	virtual bool PassesFilter(AActor* Target) const;
 
+	/** 비트별 가상 훅(IsAlly, IsMinion...)으로 필터 평가 - 커스텀 서브클래스용 */
+	bool PassesFilterWithHooks(AActor* Target) const;
+
+	/** 필터를 제외한 검증 (범위, 시야) */
+	bool PassesRangeAndSight(AActor* Target) const;
+
+	/** 컴파일된 필터 + 범위/시야 검증을 프레임 단위로 메모 (같은 프레임의 ValidateTarget → GetValidTargets 중복 제거) */
+	bool ValidateTargetMemoized(AActor* Target) const;
+
 	virtual bool IsInRange(AActor* Target) const;
 
 	virtual bool HasLineOfSight(AActor* Target) const;
@@ -203,23 +334,51 @@ protected:
 
 	/** 구체 범위 내 액터 수집 */
 	TArray<AActor*> GetActorsInSphere(const FVector& Center, float Radius) const;
+	void GetActorsInSphere(const FVector& Center, float Radius, FTargetingResultArray& OutActors) const;
 
-	/** 박스 범위 내 액터 수집 (스킬샷용) */
+	/** 박스 범위 내 액터 수집 (스킬샷용 - Spatial Hash 판정, 물리 오버랩은 폴백) */
 	TArray<AActor*> GetActorsInBox(const FVector& Start, const FVector& End, float Width) const;
+	void GetActorsInBox(const FVector& Start, const FVector& End, float Width, FTargetingResultArray& OutActors) const;
 
 	/** 부채꼴 범위 내 액터 수집 */
 	TArray<AActor*> GetActorsInCone(const FVector& Origin, const FVector& Direction, float Range, float AngleDegrees) const;
+	void GetActorsInCone(const FVector& Origin, const FVector& Direction, float Range, float AngleDegrees, FTargetingResultArray& OutActors) const;
 
 	// ===========================
 	// Utility
 	// ===========================
 
 	/** MaxTargets에 맞춰 타겟 수 제한 (가까운 순으로 정렬) */
-	virtual TArray<AActor*> LimitTargetCount(TArray<AActor*> Targets, const FVector& ReferencePoint) const;
+	virtual TArray<AActor*> LimitTargetCount(const TArray<AActor*>& Targets, const FVector& ReferencePoint) const;
+
+	/** MaxTargets에 맞춰 제자리에서 잘라냄 */
+	void LimitTargetCount(FTargetingResultArray& Targets, const FVector& ReferencePoint) const;
 
 	/** 거리순 정렬 */
 	void SortByDistance(TArray<AActor*>& Targets, const FVector& ReferencePoint) const;
+	void SortByDistance(FTargetingResultArray& Targets, const FVector& ReferencePoint) const;
 
 	/** World 가져오기 */
 	UWorld* GetWorld() const override;
+
+	// ===========================
+	// Compiled Filter
+	// ===========================
+
+	FCompiledTargetFilter CompiledFilter;
+
+	/** CustomTargetingClass 서브클래스면 true - 가상 훅 경로 사용 */
+	bool bUseFilterHooks = false;
+
+	// ===========================
+	// Per-Frame Memo
+	// ===========================
+
+	/** 쿼리 결과 캐시 키 생성 - 결과가 소유자에 의존하면 Owner까지 키에 포함 */
+	void MakeQueryKey(const FAbilityTargetData& TargetData, FTargetingQueryKey& OutKey) const;
+
+	/** (소유자, 타겟)별 ValidateTarget 결과 (ValidateMemoFrame 프레임에만 유효) - 공유 전략이라 소유자도 키에 포함 */
+	mutable TMap<TPair<TObjectKey<AActor>, TObjectKey<AActor>>, bool> ValidateMemo;
+
+	mutable uint64 ValidateMemoFrame = 0;
 };
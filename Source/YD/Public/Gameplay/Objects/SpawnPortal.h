@@ -7,6 +7,7 @@
 #include "SpawnPortal.generated.h"
 
 class UBoxComponent;
+class AEnemy_Base;
 
 UCLASS()
 class YD_API ASpawnPortal : public AActor
@@ -29,6 +30,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Spawn Portal")
 	UBoxComponent* GetSpawnBox() const { return SpawnBox; }
 
+	/** Minion type this portal spawns (null = the game mode's MinionClass) */
+	UFUNCTION(BlueprintPure, Category = "Spawn Portal")
+	TSubclassOf<AEnemy_Base> GetMinionClass() const { return MinionClass; }
+
 	/** Calculate grid spawn positions within the box */
 	UFUNCTION(BlueprintCallable, Category = "Spawn Portal")
 	TArray<FVector> GetGridSpawnPositions(int32 Count, int32 ColumnsPerRow = 5) const;
@@ -48,4 +53,8 @@ protected:
 	/** Whether this portal is active and spawning minions */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn Portal")
 	bool bIsEnabled = true;
+
+	/** Minion type spawned here - pool it through the game mode's AdditionalMinionPools */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn Portal")
+	TSubclassOf<AEnemy_Base> MinionClass;
 };